@@ -0,0 +1,1148 @@
+// HGDN micro benchmarks, running against the mock core API from `mock_api.c`.
+//
+// Output follows Go's benchmark format, so results from two commits can be compared with `benchstat`:
+//
+//     BenchmarkStringGet/short    2000000    55.3 ns/op    24 B/op    1.00 allocs/op
+//
+// `B/op` and `allocs/op` count every allocation made through the mock API or HGDN
+// in the benchmarking thread. When built with `HGDN_COUNT_API_CALLS`, `calls/op`
+// reports the number of core API calls made per operation.
+//
+// Usage: hgdn_bench [-run <substring>] [-benchtime <milliseconds>] [-count <n>] [-list]
+#include "mock_api.h"
+
+#define HGDN_IMPLEMENTATION
+#include "hgdn.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Runner
+typedef struct bench {
+    int64_t n;
+    int64_t bytes;  ///< Bytes processed per operation, for MB/s
+    int64_t elapsed_ns;
+    int64_t start_ns;
+    mock_alloc_stats allocs;
+    mock_alloc_stats start_allocs;
+    int64_t calls;
+    int64_t start_calls;
+    godot_bool running;
+} bench;
+
+typedef void (*bench_func)(bench *b);
+
+typedef struct bench_entry {
+    const char *name;
+    bench_func func;
+} bench_entry;
+
+static int64_t bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static int64_t bench_api_calls(void) {
+#ifdef HGDN_COUNT_API_CALLS
+    return hgdn_api_calls_get_total();
+#else
+    return 0;
+#endif
+}
+
+/// Start or resume measuring time, allocations and API calls
+static void bench_start(bench *b) {
+    if (!b->running) {
+        b->start_allocs = mock_api_get_alloc_stats();
+        b->start_calls = bench_api_calls();
+        b->start_ns = bench_now_ns();
+        b->running = 1;
+    }
+}
+
+/// Pause measuring, used to leave setup and teardown out of the results
+static void bench_stop(bench *b) {
+    if (b->running) {
+        b->elapsed_ns += bench_now_ns() - b->start_ns;
+        mock_alloc_stats allocs = mock_api_get_alloc_stats();
+        b->allocs.allocs += allocs.allocs - b->start_allocs.allocs;
+        b->allocs.bytes += allocs.bytes - b->start_allocs.bytes;
+        b->calls += bench_api_calls() - b->start_calls;
+        b->running = 0;
+    }
+}
+
+static void bench_set_bytes(bench *b, int64_t bytes) {
+    b->bytes = bytes;
+}
+
+// Keeps results alive, so that the compiler doesn't optimize benchmarked code away
+static volatile int64_t bench_sink;
+#define bench_keep(value)  (bench_sink += (int64_t) (value))
+
+static void bench_fail(const char *message) {
+    fprintf(stderr, "FAIL: %s\n", message);
+    exit(1);
+}
+
+static bench bench_run_n(bench_func func, int64_t n) {
+    bench b = { .n = n };
+    bench_start(&b);
+    func(&b);
+    bench_stop(&b);
+    return b;
+}
+
+static void bench_run(const bench_entry *entry, int64_t benchtime_ns) {
+    // Grow N until the benchmark runs for `benchtime_ns`, like Go's testing package
+    bench b = bench_run_n(entry->func, 1);
+    int64_t n = 1;
+    while (b.elapsed_ns < benchtime_ns && n < 1000000000) {
+        int64_t last_n = n;
+        int64_t prev_ns = b.elapsed_ns > 0 ? b.elapsed_ns : 1;
+        n = (int64_t) ((double) benchtime_ns * 1.2 * last_n / prev_ns);
+        if (n > last_n * 100) {
+            n = last_n * 100;
+        }
+        if (n <= last_n) {
+            n = last_n + 1;
+        }
+        if (n > 1000000000) {
+            n = 1000000000;
+        }
+        b = bench_run_n(entry->func, n);
+    }
+
+    printf("Benchmark%s\t%10lld\t%12.1f ns/op", entry->name, (long long) b.n, (double) b.elapsed_ns / b.n);
+    if (b.bytes > 0 && b.elapsed_ns > 0) {
+        printf("\t%10.2f MB/s", (double) b.bytes * b.n * 1000.0 / b.elapsed_ns);
+    }
+    printf("\t%10.0f B/op\t%8.2f allocs/op", (double) b.allocs.bytes / b.n, (double) b.allocs.allocs / b.n);
+#ifdef HGDN_COUNT_API_CALLS
+    printf("\t%8.2f calls/op", (double) b.calls / b.n);
+#endif
+    printf("\n");
+    fflush(stdout);
+}
+
+#define BENCH_LOOP(b)  for (int64_t bench_i = 0; bench_i < (b)->n; bench_i++)
+
+// Fixtures
+static const char *const bench_words[] = {
+    "position", "rotation", "scale", "visible", "modulate", "name", "owner", "filename",
+    "pause_mode", "process_priority", "z_index", "material", "texture", "offset", "flip_h", "flip_v",
+};
+#define BENCH_WORD_COUNT ((godot_int) (sizeof(bench_words) / sizeof(bench_words[0])))
+
+typedef struct bench_struct {
+    godot_int id;
+    godot_real speed;
+    godot_vector3 position;
+    godot_bool active;
+} bench_struct;
+
+// Memory
+static void bench_alloc(bench *b) {
+    BENCH_LOOP(b) {
+        void *ptr = hgdn_alloc(64);
+        bench_keep(ptr != NULL);
+        hgdn_free(ptr);
+    }
+}
+
+static void bench_arena_alloc(bench *b) {
+    bench_stop(b);
+    hgdn_arena arena = hgdn_new_arena(64 * 1024);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_arena_alloc(&arena, 64) != NULL);
+        if ((bench_i & 255) == 255) {
+            hgdn_arena_reset(&arena);
+        }
+    }
+    bench_stop(b);
+    hgdn_arena_destroy(&arena);
+}
+
+static void bench_arena_scratch(bench *b) {
+    BENCH_LOOP(b) {
+        hgdn_arena *arena = hgdn_scratch_arena();
+        hgdn_arena_mark mark = hgdn_arena_get_mark(arena);
+        bench_keep(hgdn_arena_alloc(arena, 64) != NULL);
+        hgdn_arena_reset_to_mark(arena, mark);
+    }
+}
+
+// Variants
+static void bench_new_variant_int(bench *b) {
+    BENCH_LOOP(b) {
+        godot_variant var = hgdn_new_int_variant(bench_i);
+        hgdn_core_api->godot_variant_destroy(&var);
+    }
+}
+
+static void bench_new_variant_vector3(bench *b) {
+    godot_vector3 value = { .elements = { 1, 2, 3 } };
+    BENCH_LOOP(b) {
+        godot_variant var = hgdn_new_vector3_variant(value);
+        hgdn_core_api->godot_variant_destroy(&var);
+    }
+}
+
+static void bench_new_variant_transform(bench *b) {
+    godot_transform value = { .elements = { 1, 0, 0, 0, 1, 0, 0, 0, 1, 4, 5, 6 } };
+    BENCH_LOOP(b) {
+        godot_variant var = hgdn_new_transform_variant(value);
+        hgdn_core_api->godot_variant_destroy(&var);
+    }
+}
+
+static void bench_new_variant_cstring(bench *b) {
+    BENCH_LOOP(b) {
+        godot_variant var = hgdn_new_cstring_variant("position");
+        hgdn_core_api->godot_variant_destroy(&var);
+    }
+}
+
+static void bench_variant_get_int(bench *b) {
+    godot_variant var = hgdn_new_int_variant(42);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_variant_get_int(&var));
+    }
+}
+
+static void bench_variant_get_vector3(bench *b) {
+    godot_vector3 value = { .elements = { 1, 2, 3 } };
+    godot_variant var = hgdn_new_vector3_variant(value);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_variant_get_vector3(&var).elements[1]);
+    }
+}
+
+static void bench_variant_get_string(bench *b) {
+    bench_stop(b);
+    godot_variant var = hgdn_new_cstring_variant("position");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_string str = hgdn_variant_get_string(&var);
+        bench_keep(str.length);
+        hgdn_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_variant_destroy(&var);
+}
+
+// Strings
+static const char bench_short_text[] = "The quick brown fox jumps over the lazy dog";
+
+static void bench_new_string(bench *b) {
+    bench_set_bytes(b, sizeof(bench_short_text) - 1);
+    BENCH_LOOP(b) {
+        godot_string str = hgdn_new_string(bench_short_text);
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+static void bench_new_wide_string(bench *b) {
+    BENCH_LOOP(b) {
+        godot_string str = hgdn_new_wide_string(L"The quick brown fox jumps over the lazy dog");
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+static void bench_string_get(bench *b) {
+    bench_stop(b);
+    godot_string gd_str = hgdn_new_string(bench_short_text);
+    bench_set_bytes(b, sizeof(bench_short_text) - 1);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_string str = hgdn_string_get(&gd_str);
+        bench_keep(str.length);
+        hgdn_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_string_get_utf8(bench *b) {
+    bench_stop(b);
+    godot_string gd_str = hgdn_new_string(bench_short_text);
+    bench_set_bytes(b, sizeof(bench_short_text) - 1);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        char buffer[256];
+        hgdn_utf8_string str = hgdn_string_get_utf8(&gd_str, buffer, sizeof(buffer));
+        bench_keep(str.length);
+        hgdn_utf8_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_wide_string_get(bench *b) {
+    bench_stop(b);
+    godot_string gd_str = hgdn_new_string(bench_short_text);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_wide_string str = hgdn_wide_string_get(&gd_str);
+        bench_keep(str.length);
+        hgdn_wide_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_string_view_get(bench *b) {
+    bench_stop(b);
+    godot_string gd_str = hgdn_new_string(bench_short_text);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_string_view view = hgdn_string_view_get(&gd_str);
+        bench_keep(view.length);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_hash_cstring(bench *b) {
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_cstring_hash(bench_words[bench_i & (BENCH_WORD_COUNT - 1)]));
+    }
+}
+
+static void bench_hash_string(bench *b) {
+    bench_stop(b);
+    godot_string gd_str = hgdn_new_string("process_priority");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_string_get_hash(&gd_str));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_intern_string(bench *b) {
+    bench_stop(b);
+    for (godot_int i = 0; i < BENCH_WORD_COUNT; i++) {
+        hgdn_intern_string(bench_words[i]);
+    }
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_intern_string(bench_words[bench_i & (BENCH_WORD_COUNT - 1)])->length);
+    }
+}
+
+static void bench_string_builder(bench *b) {
+    godot_vector3 value = { .elements = { 1.5f, 2, -3.25f } };
+    BENCH_LOOP(b) {
+        hgdn_string_builder builder = { 0 };
+        for (int i = 0; i < 8; i++) {
+            hgdn_string_builder_append_int(&builder, i * 1000);
+            hgdn_string_builder_append_char(&builder, ' ');
+            hgdn_string_builder_append_real(&builder, i * 0.5);
+            hgdn_string_builder_append_char(&builder, ' ');
+            hgdn_string_builder_append_vector3(&builder, value);
+            hgdn_string_builder_append_char(&builder, '\n');
+        }
+        godot_string str = hgdn_string_builder_to_string_own(&builder);
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+static void bench_new_formatted_string(bench *b) {
+    BENCH_LOOP(b) {
+        godot_string str = hgdn_new_formatted_string("%s: %d (%.2f)", "position", (int) bench_i, 1.5);
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+static void bench_new_formatted_string_long(bench *b) {
+    // Longer than HGDN_STRING_FORMAT_BUFFER_SIZE, so the text is formatted twice
+    static char text[HGDN_STRING_FORMAT_BUFFER_SIZE * 2];
+    memset(text, 'x', sizeof(text) - 1);
+    BENCH_LOOP(b) {
+        godot_string str = hgdn_new_formatted_string("%s %d", text, (int) bench_i);
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+// UTF-8 text for transcoding throughput, generated deterministically with a line break every 64 characters
+typedef enum bench_corpus_kind {
+    BENCH_CORPUS_ASCII,
+    BENCH_CORPUS_LATIN1,  ///< One in three characters in U+00C0..U+00FF, encoded with 2 bytes
+    BENCH_CORPUS_CJK,  ///< CJK Unified Ideographs, encoded with 3 bytes
+    BENCH_CORPUS_COUNT,
+} bench_corpus_kind;
+
+#define BENCH_CORPUS_SIZE (64 * 1024)
+static char bench_corpora[BENCH_CORPUS_COUNT][BENCH_CORPUS_SIZE + 1];
+static godot_int bench_corpus_lengths[BENCH_CORPUS_COUNT];
+
+static const char *bench_corpus_get(bench_corpus_kind kind, godot_int *length) {
+    char *out = bench_corpora[kind];
+    if (bench_corpus_lengths[kind] == 0) {
+        godot_int size = 0;
+        for (uint32_t i = 0; ; i++) {
+            uint32_t c = i % 6 == 5 ? ' ' : 'a' + (i * 7) % 26;
+            if (i % 64 == 63) {
+                c = '\n';
+            }
+            else if (kind == BENCH_CORPUS_LATIN1 && i % 3 == 0) {
+                c = 0xC0 + (i * 7) % 64;
+            }
+            else if (kind == BENCH_CORPUS_CJK) {
+                c = 0x4E00 + (i * 7919) % 20902;
+            }
+            char bytes[3];
+            int n;
+            if (c < 0x80) {
+                bytes[0] = (char) c;
+                n = 1;
+            }
+            else if (c < 0x800) {
+                bytes[0] = (char) (0xC0 | (c >> 6));
+                bytes[1] = (char) (0x80 | (c & 0x3F));
+                n = 2;
+            }
+            else {
+                bytes[0] = (char) (0xE0 | (c >> 12));
+                bytes[1] = (char) (0x80 | ((c >> 6) & 0x3F));
+                bytes[2] = (char) (0x80 | (c & 0x3F));
+                n = 3;
+            }
+            if (size + n > BENCH_CORPUS_SIZE) {
+                break;
+            }
+            memcpy(out + size, bytes, n);
+            size += n;
+        }
+        out[size] = '\0';
+        bench_corpus_lengths[kind] = size;
+    }
+    *length = bench_corpus_lengths[kind];
+    return out;
+}
+
+static void bench_new_string_corpus(bench *b, bench_corpus_kind kind) {
+    bench_stop(b);
+    godot_int length;
+    const char *text = bench_corpus_get(kind, &length);
+    bench_set_bytes(b, length);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_string str = hgdn_new_string_with_len(text, length);
+        hgdn_core_api->godot_string_destroy(&str);
+    }
+}
+
+static void bench_string_get_corpus(bench *b, bench_corpus_kind kind) {
+    bench_stop(b);
+    godot_int length;
+    const char *text = bench_corpus_get(kind, &length);
+    godot_string gd_str = hgdn_new_string_with_len(text, length);
+    bench_set_bytes(b, length);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_string str = hgdn_string_get(&gd_str);
+        if (str.length != length) {
+            bench_fail("hgdn_string_get length differs from the original text");
+        }
+        hgdn_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_string_get_utf8_corpus(bench *b, bench_corpus_kind kind) {
+    static char buffer[BENCH_CORPUS_SIZE + 1];
+    bench_stop(b);
+    godot_int length;
+    const char *text = bench_corpus_get(kind, &length);
+    godot_string gd_str = hgdn_new_string_with_len(text, length);
+    bench_set_bytes(b, length);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_utf8_string str = hgdn_string_get_utf8(&gd_str, buffer, sizeof(buffer));
+        if (str.length != length) {
+            bench_fail("hgdn_string_get_utf8 length differs from the original text");
+        }
+        hgdn_utf8_string_destroy(&str);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&gd_str);
+}
+
+static void bench_packed_string_array_get_corpus(bench *b, bench_corpus_kind kind) {
+    bench_stop(b);
+    godot_int length;
+    const char *text = bench_corpus_get(kind, &length);
+    godot_pool_string_array gd_array = hgdn_new_string_array_split(text, length, '\n');
+    bench_set_bytes(b, length);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_packed_string_array array = hgdn_packed_string_array_get(&gd_array);
+        bench_keep(array.size);
+        hgdn_packed_string_array_destroy(&array);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_pool_string_array_destroy(&gd_array);
+}
+
+#define BENCH_CORPUS_FUNCS(name, kind) \
+    static void bench_new_string_##name(bench *b) { bench_new_string_corpus(b, kind); } \
+    static void bench_string_get_##name(bench *b) { bench_string_get_corpus(b, kind); } \
+    static void bench_string_get_utf8_##name(bench *b) { bench_string_get_utf8_corpus(b, kind); } \
+    static void bench_packed_string_array_get_##name(bench *b) { bench_packed_string_array_get_corpus(b, kind); }
+
+BENCH_CORPUS_FUNCS(ascii, BENCH_CORPUS_ASCII)
+BENCH_CORPUS_FUNCS(latin1, BENCH_CORPUS_LATIN1)
+BENCH_CORPUS_FUNCS(cjk, BENCH_CORPUS_CJK)
+
+// Arrays
+static void bench_new_array(bench *b) {
+    bench_stop(b);
+    godot_variant values[8];
+    const godot_variant *ptrs[8];
+    for (int i = 0; i < 8; i++) {
+        values[i] = hgdn_new_int_variant(i);
+        ptrs[i] = &values[i];
+    }
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_array array = hgdn_new_array(ptrs, 8);
+        hgdn_core_api->godot_array_destroy(&array);
+    }
+}
+
+static void bench_new_array_own(bench *b) {
+    BENCH_LOOP(b) {
+        godot_variant values[8];
+        for (int i = 0; i < 8; i++) {
+            values[i] = hgdn_new_int_variant(i);
+        }
+        godot_array array = hgdn_new_array_own(values, 8);
+        hgdn_core_api->godot_array_destroy(&array);
+    }
+}
+
+static void bench_array_builder(bench *b) {
+    BENCH_LOOP(b) {
+        hgdn_array_builder builder = { 0 };
+        for (int i = 0; i < 8; i++) {
+            hgdn_array_builder_push_own(&builder, hgdn_new_int_variant(i));
+        }
+        godot_array array = hgdn_array_builder_finish(&builder);
+        hgdn_core_api->godot_array_destroy(&array);
+    }
+}
+
+static void bench_array_get_int(bench *b) {
+    bench_stop(b);
+    godot_variant values[8];
+    for (int i = 0; i < 8; i++) {
+        values[i] = hgdn_new_int_variant(i);
+    }
+    godot_array array = hgdn_new_array_own(values, 8);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_array_get_int(&array, bench_i & 7));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_array_destroy(&array);
+}
+
+// Pool Arrays
+static void bench_new_int_array(bench *b) {
+    static godot_int values[1024];
+    bench_set_bytes(b, sizeof(values));
+    BENCH_LOOP(b) {
+        godot_pool_int_array array = hgdn_new_int_array(values, 1024);
+        hgdn_core_api->godot_pool_int_array_destroy(&array);
+    }
+}
+
+static void bench_new_vector3_array(bench *b) {
+    static godot_vector3 values[1024];
+    bench_set_bytes(b, sizeof(values));
+    BENCH_LOOP(b) {
+        godot_pool_vector3_array array = hgdn_new_vector3_array(values, 1024);
+        hgdn_core_api->godot_pool_vector3_array_destroy(&array);
+    }
+}
+
+static void bench_new_string_array(bench *b) {
+    BENCH_LOOP(b) {
+        godot_pool_string_array array = hgdn_new_string_array(bench_words, BENCH_WORD_COUNT);
+        hgdn_core_api->godot_pool_string_array_destroy(&array);
+    }
+}
+
+static void bench_new_string_array_split(bench *b) {
+    static const char text[] = "position,rotation,scale,visible,modulate,name,owner,filename,"
+                               "pause_mode,process_priority,z_index,material,texture,offset,flip_h,flip_v";
+    bench_set_bytes(b, sizeof(text) - 1);
+    BENCH_LOOP(b) {
+        godot_pool_string_array array = hgdn_new_string_array_split(text, sizeof(text) - 1, ',');
+        hgdn_core_api->godot_pool_string_array_destroy(&array);
+    }
+}
+
+static void bench_int_array_get(bench *b) {
+    bench_stop(b);
+    godot_pool_int_array gd_array = hgdn_new_int_array_uninit(1024);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_int_array array = hgdn_int_array_get(&gd_array);
+        bench_keep(array.ptr[bench_i & 1023]);
+        hgdn_int_array_destroy(&array);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_pool_int_array_destroy(&gd_array);
+}
+
+static void bench_int_array_write(bench *b) {
+    bench_stop(b);
+    godot_pool_int_array gd_array = hgdn_new_int_array_uninit(1024);
+    bench_set_bytes(b, 1024 * sizeof(godot_int));
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_int_array_write array = hgdn_int_array_write_get(&gd_array);
+        for (godot_int i = 0; i < array.size; i++) {
+            array.ptr[i] = i;
+        }
+        hgdn_int_array_write_destroy(&array);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_pool_int_array_destroy(&gd_array);
+}
+
+static void bench_string_array_get(bench *b) {
+    bench_stop(b);
+    godot_pool_string_array gd_array = hgdn_new_string_array(bench_words, BENCH_WORD_COUNT);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_string_array array = hgdn_string_array_get(&gd_array);
+        bench_keep(array.size);
+        hgdn_string_array_destroy(&array);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_pool_string_array_destroy(&gd_array);
+}
+
+static void bench_packed_string_array_get(bench *b) {
+    bench_stop(b);
+    godot_pool_string_array gd_array = hgdn_new_string_array(bench_words, BENCH_WORD_COUNT);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_packed_string_array array = hgdn_packed_string_array_get(&gd_array);
+        bench_keep(array.size);
+        hgdn_packed_string_array_destroy(&array);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_pool_string_array_destroy(&gd_array);
+}
+
+static void bench_packed_string_array_get_arena(bench *b) {
+    bench_stop(b);
+    godot_pool_string_array gd_array = hgdn_new_string_array(bench_words, BENCH_WORD_COUNT);
+    hgdn_arena arena = hgdn_new_arena(64 * 1024);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_packed_string_array array = hgdn_packed_string_array_get_arena(&gd_array, &arena);
+        bench_keep(array.size);
+        hgdn_arena_reset(&arena);
+    }
+    bench_stop(b);
+    hgdn_arena_destroy(&arena);
+    hgdn_core_api->godot_pool_string_array_destroy(&gd_array);
+}
+
+// Dictionaries
+static const hgdn_dictionary_entry_string_int bench_dictionary_entries[] = {
+    { "position", 1 }, { "rotation", 2 }, { "scale", 3 }, { "visible", 4 },
+    { "modulate", 5 }, { "name", 6 }, { "owner", 7 }, { "filename", 8 },
+};
+
+static void bench_new_dictionary(bench *b) {
+    BENCH_LOOP(b) {
+        godot_dictionary dict = hgdn_new_dictionary_string_int(bench_dictionary_entries, 8);
+        hgdn_core_api->godot_dictionary_destroy(&dict);
+    }
+}
+
+static void bench_dictionary_get_variant(bench *b) {
+    bench_stop(b);
+    godot_dictionary dict = hgdn_new_dictionary_string_int(bench_dictionary_entries, 8);
+    godot_variant key = hgdn_new_cstring_variant("owner");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_dictionary_get_int(&dict, &key));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_variant_destroy(&key);
+    hgdn_core_api->godot_dictionary_destroy(&dict);
+}
+
+static void bench_dictionary_get_cstring(bench *b) {
+    bench_stop(b);
+    godot_dictionary dict = hgdn_new_dictionary_string_int(bench_dictionary_entries, 8);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_dictionary_string_get_int(&dict, "owner"));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_dictionary_destroy(&dict);
+}
+
+static void bench_dictionary_get_key(bench *b) {
+    bench_stop(b);
+    godot_dictionary dict = hgdn_new_dictionary_string_int(bench_dictionary_entries, 8);
+    hgdn_key key = hgdn_intern_key("owner");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_dictionary_key_get_int(&dict, key));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_dictionary_destroy(&dict);
+}
+
+// Method arguments
+static void bench_args_get(bench *b) {
+    bench_stop(b);
+    godot_variant values[2] = { hgdn_new_int_variant(42), hgdn_new_real_variant(1.5) };
+    godot_variant *args[2] = { &values[0], &values[1] };
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_args_get_int(args, 0) + hgdn_args_get_real(args, 1));
+    }
+}
+
+static void bench_args_unpack(bench *b) {
+    bench_stop(b);
+    godot_vector3 position = { .elements = { 1, 2, 3 } };
+    godot_variant values[4] = {
+        hgdn_new_int_variant(42), hgdn_new_real_variant(1.5),
+        hgdn_new_vector3_variant(position), hgdn_new_bool_variant(1),
+    };
+    godot_variant *args[4] = { &values[0], &values[1], &values[2], &values[3] };
+    bench_start(b);
+    BENCH_LOOP(b) {
+        int64_t count;
+        double speed;
+        godot_vector3 v;
+        godot_bool flag = 0;
+        if (hgdn_args_unpack(args, 4, "ifv3b?", &count, &speed, &v, &flag) != NULL) {
+            bench_fail("hgdn_args_unpack");
+        }
+        bench_keep(count + flag);
+    }
+}
+
+// Structs
+// Schemas keep a pointer to their fields, so they must outlive them
+static const hgdn_struct_field bench_struct_fields[] = {
+    hgdn_struct_field_entry(bench_struct, id, HGDN_FIELD_INT),
+    hgdn_struct_field_entry(bench_struct, speed, HGDN_FIELD_REAL),
+    hgdn_struct_field_entry(bench_struct, position, HGDN_FIELD_VECTOR3),
+    hgdn_struct_field_entry(bench_struct, active, HGDN_FIELD_BOOL),
+    { NULL },
+};
+
+static void bench_struct_to_dictionary(bench *b) {
+    bench_stop(b);
+    hgdn_struct_schema schema = hgdn_new_struct_schema(bench_struct_fields);
+    bench_struct data = { 1, 2.5f, { .elements = { 1, 2, 3 } }, 1 };
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_dictionary dict = hgdn_struct_to_dictionary(&data, &schema);
+        hgdn_core_api->godot_dictionary_destroy(&dict);
+    }
+    bench_stop(b);
+    hgdn_struct_schema_destroy(&schema);
+}
+
+static void bench_struct_from_dictionary(bench *b) {
+    bench_stop(b);
+    hgdn_struct_schema schema = hgdn_new_struct_schema(bench_struct_fields);
+    bench_struct data = { 1, 2.5f, { .elements = { 1, 2, 3 } }, 1 };
+    godot_dictionary dict = hgdn_struct_to_dictionary(&data, &schema);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        bench_struct out;
+        bench_keep(hgdn_struct_from_dictionary(&out, &schema, &dict));
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_dictionary_destroy(&dict);
+    hgdn_struct_schema_destroy(&schema);
+}
+
+// Objects
+static void bench_method_bind_get(bench *b) {
+    BENCH_LOOP(b) {
+        bench_keep(hgdn_method_bind_get("MockNode", "get_position") != NULL);
+    }
+}
+
+static void bench_object_get_named(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_variant position = hgdn_object_get_named(node, "position");
+        hgdn_core_api->godot_variant_destroy(&position);
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+// C strings go through the interned names, other property types through Object.call
+static void bench_object_get_cstring(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_variant position = hgdn_object_get(node, "position");
+        hgdn_core_api->godot_variant_destroy(&position);
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+static void bench_object_get_string(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    godot_string property = hgdn_new_string("position");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_variant position = hgdn_object_get(node, &property);
+        hgdn_core_api->godot_variant_destroy(&position);
+    }
+    bench_stop(b);
+    hgdn_core_api->godot_string_destroy(&property);
+    mock_api_free_node(node);
+}
+
+static void bench_object_set_named(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_vector2 position = { .elements = { (godot_real) bench_i, 2 } };
+        hgdn_object_set_named_own(node, "position", hgdn_new_vector2_variant(position));
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+// Calling MockNode.add(int, int) -> int through the engine's generic paths and through ptrcall
+static void bench_object_callv(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_variant args[2] = { hgdn_new_int_variant(bench_i), hgdn_new_int_variant(1) };
+        godot_array array = hgdn_new_array_own(args, 2);
+        if (hgdn_variant_get_int_own(hgdn_object_callv_own(node, "add", array)) != bench_i + 1) {
+            bench_fail("hgdn_object_callv_own result");
+        }
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+static void bench_object_callp(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        godot_variant args[2] = { hgdn_new_int_variant(bench_i), hgdn_new_int_variant(1) };
+        if (hgdn_variant_get_int_own(hgdn_object_callp_own(node, "add", args, 2)) != bench_i + 1) {
+            bench_fail("hgdn_object_callp_own result");
+        }
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+static void bench_object_ptrcall(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    godot_method_bind *add = hgdn_method_bind_get("MockNode", "add");
+    bench_start(b);
+    BENCH_LOOP(b) {
+        int64_t x = bench_i, y = 1;
+        if (hgdn_method_bind_ptrcall_int(add, node, hgdn_ptrcall_args(&x, &y)) != bench_i + 1) {
+            bench_fail("hgdn_method_bind_ptrcall_int result");
+        }
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+static void bench_object_ptrcall_lookup(bench *b) {
+    bench_stop(b);
+    godot_object *node = mock_api_new_node();
+    bench_start(b);
+    BENCH_LOOP(b) {
+        int64_t x = bench_i, y = 1;
+        godot_method_bind *add = hgdn_method_bind_get("MockNode", "add");
+        if (hgdn_method_bind_ptrcall_int(add, node, hgdn_ptrcall_args(&x, &y)) != bench_i + 1) {
+            bench_fail("hgdn_method_bind_ptrcall_int result");
+        }
+    }
+    bench_stop(b);
+    mock_api_free_node(node);
+}
+
+static void bench_instance_pool(bench *b) {
+    bench_stop(b);
+    hgdn_instance_pool *pool = hgdn_instance_pool_new(sizeof(bench_struct), HGDN_INSTANCE_POOL_CHUNK_SIZE);
+    void *live[16];
+    bench_start(b);
+    BENCH_LOOP(b) {
+        void **slot = &live[bench_i & 15];
+        if (bench_i >= 16) {
+            hgdn_instance_pool_free(NULL, pool, *slot);
+        }
+        *slot = hgdn_instance_pool_alloc(NULL, pool);
+    }
+    bench_stop(b);
+    for (int64_t i = 0; i < b->n && i < 16; i++) {
+        hgdn_instance_pool_free(NULL, pool, live[i]);
+    }
+    hgdn_instance_pool_destroy(pool);
+}
+
+// Logging
+static void bench_print(bench *b) {
+    BENCH_LOOP(b) {
+        hgdn_print("%s: %d", "frame", (int) bench_i);
+    }
+}
+
+static void bench_print_async(bench *b) {
+    bench_stop(b);
+    hgdn_log_async_start(1024);
+    bench_start(b);
+    BENCH_LOOP(b) {
+        hgdn_print("%s: %d", "frame", (int) bench_i);
+        if ((bench_i & 255) == 255) {
+            hgdn_log_flush();
+        }
+    }
+    hgdn_log_flush();
+    bench_stop(b);
+    hgdn_log_async_stop();
+}
+
+// Formats from several threads at once, checking every result, with messages
+// both shorter and longer than HGDN_STRING_FORMAT_BUFFER_SIZE
+#define BENCH_STRESS_THREADS 8
+#define BENCH_STRESS_MAX_PADDING (HGDN_STRING_FORMAT_BUFFER_SIZE * 3)
+
+static char bench_stress_padding[BENCH_STRESS_MAX_PADDING];
+
+typedef struct bench_stress_thread {
+    pthread_t thread;
+    int id;
+    int64_t n;
+    mock_alloc_stats allocs;
+} bench_stress_thread;
+
+static void *bench_format_stress_thread(void *arg) {
+    bench_stress_thread *t = (bench_stress_thread *) arg;
+    char expected[BENCH_STRESS_MAX_PADDING + 64];
+    char buffer[256];
+    mock_alloc_stats start = mock_api_get_alloc_stats();
+    for (int64_t i = 0; i < t->n; i++) {
+        int padding_size = (int) ((i * 37 + t->id * 101) % BENCH_STRESS_MAX_PADDING);
+        snprintf(expected, sizeof(expected), "thread %d message %lld: %.*s", t->id, (long long) i, padding_size, bench_stress_padding);
+
+        godot_string gd_str = hgdn_new_formatted_string("thread %d message %lld: %.*s", t->id, (long long) i, padding_size, bench_stress_padding);
+        hgdn_utf8_string str = hgdn_string_get_utf8(&gd_str, buffer, sizeof(buffer));
+        if (strcmp(str.ptr, expected) != 0) {
+            bench_fail("hgdn_new_formatted_string result differs from snprintf");
+        }
+        hgdn_utf8_string_destroy(&str);
+        hgdn_core_api->godot_string_destroy(&gd_str);
+
+        hgdn_print("thread %d message %lld: %.*s", t->id, (long long) i, padding_size, bench_stress_padding);
+        if (strcmp(mock_api_last_print(), expected) != 0) {
+            bench_fail("hgdn_print message differs from snprintf");
+        }
+
+        if ((i & 7) == 7) {
+            // Let other threads run in between, even on a single core
+            sched_yield();
+        }
+    }
+    mock_alloc_stats end = mock_api_get_alloc_stats();
+    t->allocs.allocs = end.allocs - start.allocs;
+    t->allocs.bytes = end.bytes - start.bytes;
+    return NULL;
+}
+
+static void bench_format_stress(bench *b) {
+    bench_stop(b);
+    for (int i = 0; i < BENCH_STRESS_MAX_PADDING; i++) {
+        bench_stress_padding[i] = 'a' + i % 26;
+    }
+    bench_start(b);
+    bench_stress_thread threads[BENCH_STRESS_THREADS];
+    for (int i = 0; i < BENCH_STRESS_THREADS; i++) {
+        threads[i].id = i;
+        threads[i].n = b->n / BENCH_STRESS_THREADS + (i < b->n % BENCH_STRESS_THREADS);
+        if (pthread_create(&threads[i].thread, NULL, bench_format_stress_thread, &threads[i]) != 0) {
+            bench_fail("pthread_create");
+        }
+    }
+    for (int i = 0; i < BENCH_STRESS_THREADS; i++) {
+        pthread_join(threads[i].thread, NULL);
+        b->allocs.allocs += threads[i].allocs.allocs;
+        b->allocs.bytes += threads[i].allocs.bytes;
+    }
+}
+
+static const bench_entry bench_entries[] = {
+    { "Alloc", bench_alloc },
+    { "Arena/alloc", bench_arena_alloc },
+    { "Arena/scratch", bench_arena_scratch },
+    { "NewVariant/int", bench_new_variant_int },
+    { "NewVariant/vector3", bench_new_variant_vector3 },
+    { "NewVariant/transform", bench_new_variant_transform },
+    { "NewVariant/cstring", bench_new_variant_cstring },
+    { "VariantGet/int", bench_variant_get_int },
+    { "VariantGet/vector3", bench_variant_get_vector3 },
+    { "VariantGet/string", bench_variant_get_string },
+    { "NewString/short", bench_new_string },
+    { "NewWideString/short", bench_new_wide_string },
+    { "StringGet/short", bench_string_get },
+    { "StringGetUtf8/short", bench_string_get_utf8 },
+    { "WideStringGet/short", bench_wide_string_get },
+    { "StringViewGet/short", bench_string_view_get },
+    { "Hash/cstring", bench_hash_cstring },
+    { "Hash/string", bench_hash_string },
+    { "InternString", bench_intern_string },
+    { "StringBuilder", bench_string_builder },
+    { "Transcode/NewString/ascii/64KiB", bench_new_string_ascii },
+    { "Transcode/NewString/latin1/64KiB", bench_new_string_latin1 },
+    { "Transcode/NewString/cjk/64KiB", bench_new_string_cjk },
+    { "Transcode/StringGet/ascii/64KiB", bench_string_get_ascii },
+    { "Transcode/StringGet/latin1/64KiB", bench_string_get_latin1 },
+    { "Transcode/StringGet/cjk/64KiB", bench_string_get_cjk },
+    { "Transcode/StringGetUtf8/ascii/64KiB", bench_string_get_utf8_ascii },
+    { "Transcode/StringGetUtf8/latin1/64KiB", bench_string_get_utf8_latin1 },
+    { "Transcode/StringGetUtf8/cjk/64KiB", bench_string_get_utf8_cjk },
+    { "Transcode/PackedStringArrayGet/ascii/64KiB", bench_packed_string_array_get_ascii },
+    { "Transcode/PackedStringArrayGet/latin1/64KiB", bench_packed_string_array_get_latin1 },
+    { "Transcode/PackedStringArrayGet/cjk/64KiB", bench_packed_string_array_get_cjk },
+    { "NewFormattedString/short", bench_new_formatted_string },
+    { "NewFormattedString/long", bench_new_formatted_string_long },
+    { "NewArray/copy", bench_new_array },
+    { "NewArray/own", bench_new_array_own },
+    { "NewArray/builder", bench_array_builder },
+    { "ArrayGet/int", bench_array_get_int },
+    { "NewPoolArray/int", bench_new_int_array },
+    { "NewPoolArray/vector3", bench_new_vector3_array },
+    { "NewPoolArray/string", bench_new_string_array },
+    { "NewPoolArray/string_split", bench_new_string_array_split },
+    { "PoolArrayGet/int", bench_int_array_get },
+    { "PoolArrayWrite/int", bench_int_array_write },
+    { "StringArrayGet", bench_string_array_get },
+    { "PackedStringArrayGet/heap", bench_packed_string_array_get },
+    { "PackedStringArrayGet/arena", bench_packed_string_array_get_arena },
+    { "NewDictionary/string_int", bench_new_dictionary },
+    { "DictionaryGet/variant", bench_dictionary_get_variant },
+    { "DictionaryGet/cstring", bench_dictionary_get_cstring },
+    { "DictionaryGet/key", bench_dictionary_get_key },
+    { "ArgsGet", bench_args_get },
+    { "ArgsUnpack", bench_args_unpack },
+    { "Struct/to_dictionary", bench_struct_to_dictionary },
+    { "Struct/from_dictionary", bench_struct_from_dictionary },
+    { "MethodBindGet", bench_method_bind_get },
+    { "Object/get_named", bench_object_get_named },
+    { "Object/get/cstring", bench_object_get_cstring },
+    { "Object/get/string", bench_object_get_string },
+    { "Object/set_named", bench_object_set_named },
+    { "ObjectCall/callv", bench_object_callv },
+    { "ObjectCall/callp", bench_object_callp },
+    { "ObjectCall/ptrcall", bench_object_ptrcall },
+    { "ObjectCall/ptrcall_lookup", bench_object_ptrcall_lookup },
+    { "InstancePool", bench_instance_pool },
+    { "Print/sync", bench_print },
+    { "Print/async", bench_print_async },
+    { "FormatStress/threads=8", bench_format_stress },
+};
+#define BENCH_ENTRY_COUNT ((int) (sizeof(bench_entries) / sizeof(bench_entries[0])))
+
+static void bench_print_header(void) {
+    // Configuration lines are picked up by benchstat
+    printf("pkg: hgdn/bench\n");
+    printf("hgdn-options:");
+#ifdef HGDN_USE_UTF8_TRANSCODER
+    printf(" HGDN_USE_UTF8_TRANSCODER");
+#endif
+#ifdef HGDN_COUNT_API_CALLS
+    printf(" HGDN_COUNT_API_CALLS");
+#endif
+#ifdef HGDN_MEMORY_STATS
+    printf(" HGDN_MEMORY_STATS");
+#endif
+#ifdef HGDN_PROFILE
+    printf(" HGDN_PROFILE");
+#endif
+#ifdef HGDN_NO_SIMD
+    printf(" HGDN_NO_SIMD");
+#endif
+    printf("\n");
+}
+
+int main(int argc, char **argv) {
+    const char *filter = NULL;
+    int64_t benchtime_ms = 100;
+    int count = 1;
+    godot_bool list = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-run") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        }
+        else if (strcmp(argv[i], "-benchtime") == 0 && i + 1 < argc) {
+            benchtime_ms = strtoll(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "-count") == 0 && i + 1 < argc) {
+            count = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "-list") == 0) {
+            list = 1;
+        }
+        else {
+            fprintf(stderr, "Usage: %s [-run <substring>] [-benchtime <milliseconds>] [-count <n>] [-list]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (list) {
+        for (int i = 0; i < BENCH_ENTRY_COUNT; i++) {
+            printf("Benchmark%s\n", bench_entries[i].name);
+        }
+        return 0;
+    }
+
+    mock_api_init();
+    bench_print_header();
+    for (int i = 0; i < BENCH_ENTRY_COUNT; i++) {
+        if (filter && strstr(bench_entries[i].name, filter) == NULL) {
+            continue;
+        }
+        for (int c = 0; c < count; c++) {
+            bench_run(&bench_entries[i], benchtime_ms * 1000000);
+        }
+    }
+    mock_api_terminate();
+    return 0;
+}
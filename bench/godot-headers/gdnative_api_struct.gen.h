@@ -0,0 +1,430 @@
+// Minimal stand-in for godot-headers 3.x, used for building the benchmarks without a Godot checkout.
+//
+// Only declares what `hgdn.h` and the mock core API in `mock_api.c` use, with the same names,
+// signatures and type sizes as the real headers. Build with `make GODOT_HEADERS=path/to/godot-headers`
+// to use the real ones instead.
+#ifndef GDNATIVE_API_STRUCT_GEN_H
+#define GDNATIVE_API_STRUCT_GEN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <wchar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GDN_EXPORT
+#define GDCALLINGCONV
+#define GDAPI GDCALLINGCONV
+
+typedef int godot_int;
+typedef float godot_real;
+typedef bool godot_bool;
+typedef void godot_object;
+
+typedef enum {
+    GODOT_OK,
+    GODOT_FAILED,
+} godot_error;
+
+// Opaque types, sized like in Godot
+#define GDNATIVE_STUB_OPAQUE(name, size) \
+    typedef struct { \
+        uint8_t _dont_touch_that[size]; \
+    } name;
+
+GDNATIVE_STUB_OPAQUE(godot_string, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_char_string, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_string_name, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_variant, 16 + sizeof(int64_t))
+GDNATIVE_STUB_OPAQUE(godot_array, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_dictionary, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_node_path, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_rid, sizeof(void *))
+GDNATIVE_STUB_OPAQUE(godot_method_bind, 1)
+
+#define GDNATIVE_STUB_POOL_ARRAY_TYPES(kind) \
+    GDNATIVE_STUB_OPAQUE(godot_pool_##kind##_array, sizeof(void *)) \
+    GDNATIVE_STUB_OPAQUE(godot_pool_##kind##_array_read_access, 1) \
+    GDNATIVE_STUB_OPAQUE(godot_pool_##kind##_array_write_access, 1)
+
+GDNATIVE_STUB_POOL_ARRAY_TYPES(byte)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(int)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(real)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(string)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(vector2)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(vector3)
+GDNATIVE_STUB_POOL_ARRAY_TYPES(color)
+
+typedef enum godot_variant_type {
+    GODOT_VARIANT_TYPE_NIL,
+    GODOT_VARIANT_TYPE_BOOL,
+    GODOT_VARIANT_TYPE_INT,
+    GODOT_VARIANT_TYPE_REAL,
+    GODOT_VARIANT_TYPE_STRING,
+    GODOT_VARIANT_TYPE_VECTOR2,
+    GODOT_VARIANT_TYPE_RECT2,
+    GODOT_VARIANT_TYPE_VECTOR3,
+    GODOT_VARIANT_TYPE_TRANSFORM2D,
+    GODOT_VARIANT_TYPE_PLANE,
+    GODOT_VARIANT_TYPE_QUAT,
+    GODOT_VARIANT_TYPE_AABB,
+    GODOT_VARIANT_TYPE_BASIS,
+    GODOT_VARIANT_TYPE_TRANSFORM,
+    GODOT_VARIANT_TYPE_COLOR,
+    GODOT_VARIANT_TYPE_NODE_PATH,
+    GODOT_VARIANT_TYPE_RID,
+    GODOT_VARIANT_TYPE_OBJECT,
+    GODOT_VARIANT_TYPE_DICTIONARY,
+    GODOT_VARIANT_TYPE_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_INT_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_REAL_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_STRING_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_VECTOR2_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_VECTOR3_ARRAY,
+    GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY,
+} godot_variant_type;
+
+typedef enum godot_variant_call_error_error {
+    GODOT_CALL_ERROR_CALL_OK,
+    GODOT_CALL_ERROR_CALL_ERROR_INVALID_METHOD,
+    GODOT_CALL_ERROR_CALL_ERROR_INVALID_ARGUMENT,
+    GODOT_CALL_ERROR_CALL_ERROR_TOO_MANY_ARGUMENTS,
+    GODOT_CALL_ERROR_CALL_ERROR_TOO_FEW_ARGUMENTS,
+    GODOT_CALL_ERROR_CALL_ERROR_INSTANCE_IS_NULL,
+} godot_variant_call_error_error;
+
+typedef struct godot_variant_call_error {
+    godot_variant_call_error_error error;
+    int argument;
+    godot_variant_type expected;
+} godot_variant_call_error;
+
+// GDNative
+typedef struct godot_gdnative_api_version {
+    unsigned int major;
+    unsigned int minor;
+} godot_gdnative_api_version;
+
+typedef struct godot_gdnative_api_struct {
+    unsigned int type;
+    godot_gdnative_api_version version;
+    const struct godot_gdnative_api_struct *next;
+} godot_gdnative_api_struct;
+
+enum GDNATIVE_API_TYPES {
+    GDNATIVE_CORE,
+    GDNATIVE_EXT_NATIVESCRIPT,
+    GDNATIVE_EXT_PLUGINSCRIPT,
+    GDNATIVE_EXT_ANDROID,
+    GDNATIVE_EXT_ARVR,
+    GDNATIVE_EXT_VIDEODECODER,
+    GDNATIVE_EXT_NET,
+};
+
+struct godot_gdnative_core_api_struct;
+
+typedef struct {
+    godot_bool in_editor;
+    uint64_t core_api_hash;
+    uint64_t editor_api_hash;
+    uint64_t no_api_hash;
+    void (*report_version_mismatch)(const godot_object *p_library, const char *p_what, godot_gdnative_api_version p_want, godot_gdnative_api_version p_have);
+    void (*report_loading_error)(const godot_object *p_library, const char *p_what);
+    godot_object *gd_native_library;
+    const struct godot_gdnative_core_api_struct *api_struct;
+    const godot_string *active_library_path;
+} godot_gdnative_init_options;
+
+typedef struct {
+    godot_bool in_editor;
+} godot_gdnative_terminate_options;
+
+typedef godot_object *(*godot_class_constructor)();
+
+// NativeScript
+typedef enum {
+    GODOT_METHOD_RPC_MODE_DISABLED,
+    GODOT_METHOD_RPC_MODE_REMOTE,
+    GODOT_METHOD_RPC_MODE_MASTER,
+    GODOT_METHOD_RPC_MODE_PUPPET,
+    GODOT_METHOD_RPC_MODE_SLAVE = GODOT_METHOD_RPC_MODE_PUPPET,
+    GODOT_METHOD_RPC_MODE_REMOTESYNC,
+    GODOT_METHOD_RPC_MODE_SYNC = GODOT_METHOD_RPC_MODE_REMOTESYNC,
+    GODOT_METHOD_RPC_MODE_MASTERSYNC,
+    GODOT_METHOD_RPC_MODE_PUPPETSYNC,
+} godot_method_rpc_mode;
+
+typedef enum {
+    GODOT_PROPERTY_HINT_NONE,
+    GODOT_PROPERTY_HINT_RANGE,
+    GODOT_PROPERTY_HINT_EXP_RANGE,
+    GODOT_PROPERTY_HINT_ENUM,
+} godot_property_hint;
+
+typedef enum {
+    GODOT_PROPERTY_USAGE_STORAGE = 1,
+    GODOT_PROPERTY_USAGE_EDITOR = 2,
+    GODOT_PROPERTY_USAGE_NETWORK = 4,
+    GODOT_PROPERTY_USAGE_DEFAULT = GODOT_PROPERTY_USAGE_STORAGE | GODOT_PROPERTY_USAGE_EDITOR | GODOT_PROPERTY_USAGE_NETWORK,
+} godot_property_usage_flags;
+
+typedef struct {
+    godot_method_rpc_mode rset_type;
+    godot_int type;
+    godot_property_hint hint;
+    godot_string hint_string;
+    godot_property_usage_flags usage;
+    godot_variant default_value;
+} godot_property_attributes;
+
+typedef struct {
+    void *(*create_func)(godot_object *, void *);
+    void *method_data;
+    void (*free_func)(void *);
+} godot_instance_create_func;
+
+typedef struct {
+    void (*destroy_func)(godot_object *, void *, void *);
+    void *method_data;
+    void (*free_func)(void *);
+} godot_instance_destroy_func;
+
+typedef struct {
+    godot_method_rpc_mode rpc_type;
+} godot_method_attributes;
+
+typedef struct {
+    godot_variant (*method)(godot_object *, void *, void *, int, godot_variant **);
+    void *method_data;
+    void (*free_func)(void *);
+} godot_instance_method;
+
+typedef struct {
+    void (*set_func)(godot_object *, void *, void *, godot_variant *);
+    void *method_data;
+    void (*free_func)(void *);
+} godot_property_set_func;
+
+typedef struct {
+    godot_variant (*get_func)(godot_object *, void *, void *);
+    void *method_data;
+    void (*free_func)(void *);
+} godot_property_get_func;
+
+typedef struct {
+    godot_string name;
+    godot_int type;
+    godot_property_hint hint;
+    godot_string hint_string;
+    godot_property_usage_flags usage;
+    godot_variant default_value;
+} godot_signal_argument;
+
+typedef struct {
+    godot_string name;
+    int num_args;
+    godot_signal_argument *args;
+    int num_default_args;
+    godot_variant *default_args;
+} godot_signal;
+
+typedef struct {
+    godot_string name;
+    godot_variant_type type;
+    godot_property_hint hint;
+    godot_string hint_string;
+} godot_method_arg;
+
+// Core API entries: F(return type, name, parameters)
+#define GDNATIVE_STUB_VARIANT_API(F, kind, ctype) \
+    F(void, godot_variant_new_##kind, (godot_variant *r_dest, const ctype *p_value)) \
+    F(ctype, godot_variant_as_##kind, (const godot_variant *p_self))
+
+#define GDNATIVE_STUB_POOL_ARRAY_API(F, kind, ctype, arg_type) \
+    F(void, godot_pool_##kind##_array_new, (godot_pool_##kind##_array *r_dest)) \
+    F(void, godot_pool_##kind##_array_new_copy, (godot_pool_##kind##_array *r_dest, const godot_pool_##kind##_array *p_src)) \
+    F(void, godot_pool_##kind##_array_set, (godot_pool_##kind##_array *p_self, const godot_int p_idx, arg_type p_data)) \
+    F(ctype, godot_pool_##kind##_array_get, (const godot_pool_##kind##_array *p_self, const godot_int p_idx)) \
+    F(void, godot_pool_##kind##_array_resize, (godot_pool_##kind##_array *p_self, const godot_int p_size)) \
+    F(godot_int, godot_pool_##kind##_array_size, (const godot_pool_##kind##_array *p_self)) \
+    F(godot_pool_##kind##_array_read_access *, godot_pool_##kind##_array_read, (const godot_pool_##kind##_array *p_self)) \
+    F(godot_pool_##kind##_array_write_access *, godot_pool_##kind##_array_write, (godot_pool_##kind##_array *p_self)) \
+    F(const ctype *, godot_pool_##kind##_array_read_access_ptr, (const godot_pool_##kind##_array_read_access *p_read)) \
+    F(ctype *, godot_pool_##kind##_array_write_access_ptr, (const godot_pool_##kind##_array_write_access *p_write)) \
+    F(void, godot_pool_##kind##_array_read_access_destroy, (godot_pool_##kind##_array_read_access *p_read)) \
+    F(void, godot_pool_##kind##_array_write_access_destroy, (godot_pool_##kind##_array_write_access *p_write)) \
+    F(void, godot_pool_##kind##_array_destroy, (godot_pool_##kind##_array *p_self))
+
+#define GDNATIVE_STUB_CORE_API(F) \
+    F(godot_method_bind *, godot_method_bind_get_method, (const char *p_classname, const char *p_methodname)) \
+    F(void, godot_method_bind_ptrcall, (godot_method_bind *p_method_bind, godot_object *p_instance, const void **p_args, void *p_ret)) \
+    F(godot_variant, godot_method_bind_call, (godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error)) \
+    F(godot_class_constructor, godot_get_class_constructor, (const char *p_classname)) \
+    F(godot_object *, godot_global_get_singleton, (char *p_name)) \
+    F(void *, godot_alloc, (int p_bytes)) \
+    F(void *, godot_realloc, (void *p_ptr, int p_bytes)) \
+    F(void, godot_free, (void *p_ptr)) \
+    F(void, godot_print_error, (const char *p_description, const char *p_function, const char *p_file, int p_line)) \
+    F(void, godot_print_warning, (const char *p_description, const char *p_function, const char *p_file, int p_line)) \
+    F(void, godot_print, (const godot_string *p_message)) \
+    F(void, godot_string_new, (godot_string *r_dest)) \
+    F(void, godot_string_new_copy, (godot_string *r_dest, const godot_string *p_src)) \
+    F(void, godot_string_new_with_wide_string, (godot_string *r_dest, const wchar_t *p_contents, const int p_size)) \
+    F(wchar_t *, godot_string_operator_index, (godot_string *p_self, const godot_int p_idx)) \
+    F(wchar_t, godot_string_operator_index_const, (const godot_string *p_self, const godot_int p_idx)) \
+    F(const wchar_t *, godot_string_wide_str, (const godot_string *p_self)) \
+    F(godot_int, godot_string_length, (const godot_string *p_self)) \
+    F(godot_char_string, godot_string_utf8, (const godot_string *p_self)) \
+    F(godot_string, godot_string_chars_to_utf8, (const char *p_utf8)) \
+    F(godot_string, godot_string_chars_to_utf8_with_len, (const char *p_utf8, godot_int p_len)) \
+    F(uint32_t, godot_string_hash, (const godot_string *p_self)) \
+    F(godot_bool, godot_string_operator_equal, (const godot_string *p_self, const godot_string *p_b)) \
+    F(void, godot_string_destroy, (godot_string *p_self)) \
+    F(godot_int, godot_char_string_length, (const godot_char_string *p_cs)) \
+    F(const char *, godot_char_string_get_data, (const godot_char_string *p_cs)) \
+    F(void, godot_char_string_destroy, (godot_char_string *p_cs)) \
+    F(void, godot_string_name_new, (godot_string_name *r_dest, const godot_string *p_name)) \
+    F(void, godot_string_name_new_data, (godot_string_name *r_dest, const char *p_name)) \
+    F(godot_string, godot_string_name_get_name, (const godot_string_name *p_self)) \
+    F(uint32_t, godot_string_name_get_hash, (const godot_string_name *p_self)) \
+    F(const void *, godot_string_name_get_data_unique_pointer, (const godot_string_name *p_self)) \
+    F(void, godot_string_name_destroy, (godot_string_name *p_self)) \
+    F(godot_variant_type, godot_variant_get_type, (const godot_variant *p_v)) \
+    F(void, godot_variant_new_copy, (godot_variant *r_dest, const godot_variant *p_src)) \
+    F(void, godot_variant_new_nil, (godot_variant *r_dest)) \
+    F(void, godot_variant_new_bool, (godot_variant *r_dest, const godot_bool p_b)) \
+    F(void, godot_variant_new_uint, (godot_variant *r_dest, const uint64_t p_i)) \
+    F(void, godot_variant_new_int, (godot_variant *r_dest, const int64_t p_i)) \
+    F(void, godot_variant_new_real, (godot_variant *r_dest, const double p_r)) \
+    F(void, godot_variant_new_object, (godot_variant *r_dest, const godot_object *p_obj)) \
+    F(godot_bool, godot_variant_as_bool, (const godot_variant *p_self)) \
+    F(uint64_t, godot_variant_as_uint, (const godot_variant *p_self)) \
+    F(int64_t, godot_variant_as_int, (const godot_variant *p_self)) \
+    F(double, godot_variant_as_real, (const godot_variant *p_self)) \
+    F(godot_object *, godot_variant_as_object, (const godot_variant *p_self)) \
+    F(godot_variant, godot_variant_call, (godot_variant *p_self, const godot_string *p_method, const godot_variant **p_args, const godot_int p_argcount, godot_variant_call_error *r_error)) \
+    F(godot_bool, godot_variant_operator_equal, (const godot_variant *p_self, const godot_variant *p_other)) \
+    F(godot_bool, godot_variant_hash_compare, (const godot_variant *p_self, const godot_variant *p_other)) \
+    F(void, godot_variant_destroy, (godot_variant *p_self)) \
+    GDNATIVE_STUB_VARIANT_API(F, string, godot_string) \
+    GDNATIVE_STUB_VARIANT_API(F, vector2, godot_vector2) \
+    GDNATIVE_STUB_VARIANT_API(F, vector3, godot_vector3) \
+    GDNATIVE_STUB_VARIANT_API(F, rect2, godot_rect2) \
+    GDNATIVE_STUB_VARIANT_API(F, plane, godot_plane) \
+    GDNATIVE_STUB_VARIANT_API(F, quat, godot_quat) \
+    GDNATIVE_STUB_VARIANT_API(F, aabb, godot_aabb) \
+    GDNATIVE_STUB_VARIANT_API(F, basis, godot_basis) \
+    GDNATIVE_STUB_VARIANT_API(F, transform2d, godot_transform2d) \
+    GDNATIVE_STUB_VARIANT_API(F, transform, godot_transform) \
+    GDNATIVE_STUB_VARIANT_API(F, color, godot_color) \
+    GDNATIVE_STUB_VARIANT_API(F, node_path, godot_node_path) \
+    GDNATIVE_STUB_VARIANT_API(F, rid, godot_rid) \
+    GDNATIVE_STUB_VARIANT_API(F, dictionary, godot_dictionary) \
+    GDNATIVE_STUB_VARIANT_API(F, array, godot_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_byte_array, godot_pool_byte_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_int_array, godot_pool_int_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_real_array, godot_pool_real_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_string_array, godot_pool_string_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_vector2_array, godot_pool_vector2_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_vector3_array, godot_pool_vector3_array) \
+    GDNATIVE_STUB_VARIANT_API(F, pool_color_array, godot_pool_color_array) \
+    F(void, godot_array_new, (godot_array *r_dest)) \
+    F(void, godot_array_new_copy, (godot_array *r_dest, const godot_array *p_src)) \
+    F(void, godot_array_set, (godot_array *p_self, const godot_int p_idx, const godot_variant *p_value)) \
+    F(godot_variant, godot_array_get, (const godot_array *p_self, const godot_int p_idx)) \
+    F(godot_variant *, godot_array_operator_index, (godot_array *p_self, const godot_int p_idx)) \
+    F(const godot_variant *, godot_array_operator_index_const, (const godot_array *p_self, const godot_int p_idx)) \
+    F(void, godot_array_append, (godot_array *p_self, const godot_variant *p_value)) \
+    F(void, godot_array_clear, (godot_array *p_self)) \
+    F(void, godot_array_resize, (godot_array *p_self, const godot_int p_size)) \
+    F(godot_int, godot_array_size, (const godot_array *p_self)) \
+    F(void, godot_array_destroy, (godot_array *p_self)) \
+    F(void, godot_dictionary_new, (godot_dictionary *r_dest)) \
+    F(void, godot_dictionary_new_copy, (godot_dictionary *r_dest, const godot_dictionary *p_src)) \
+    F(godot_int, godot_dictionary_size, (const godot_dictionary *p_self)) \
+    F(godot_bool, godot_dictionary_has, (const godot_dictionary *p_self, const godot_variant *p_key)) \
+    F(godot_variant, godot_dictionary_get, (const godot_dictionary *p_self, const godot_variant *p_key)) \
+    F(void, godot_dictionary_set, (godot_dictionary *p_self, const godot_variant *p_key, const godot_variant *p_value)) \
+    F(godot_variant *, godot_dictionary_operator_index, (godot_dictionary *p_self, const godot_variant *p_key)) \
+    F(const godot_variant *, godot_dictionary_operator_index_const, (const godot_dictionary *p_self, const godot_variant *p_key)) \
+    F(godot_variant *, godot_dictionary_next, (const godot_dictionary *p_self, const godot_variant *p_key)) \
+    F(void, godot_dictionary_destroy, (godot_dictionary *p_self)) \
+    F(void, godot_node_path_new, (godot_node_path *r_dest, const godot_string *p_from)) \
+    F(godot_string, godot_node_path_as_string, (const godot_node_path *p_self)) \
+    F(void, godot_node_path_destroy, (godot_node_path *p_self)) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, byte, uint8_t, const uint8_t) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, int, godot_int, const godot_int) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, real, godot_real, const godot_real) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, string, godot_string, const godot_string *) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, vector2, godot_vector2, const godot_vector2 *) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, vector3, godot_vector3, const godot_vector3 *) \
+    GDNATIVE_STUB_POOL_ARRAY_API(F, color, godot_color, const godot_color *)
+
+#define GDNATIVE_STUB_API_FIELD(ret, name, params)  ret (*name) params;
+
+typedef struct godot_gdnative_core_api_struct {
+    unsigned int type;
+    godot_gdnative_api_version version;
+    const godot_gdnative_api_struct *next;
+    unsigned int num_extensions;
+    const godot_gdnative_api_struct **extensions;
+    GDNATIVE_STUB_CORE_API(GDNATIVE_STUB_API_FIELD)
+} godot_gdnative_core_api_struct;
+
+typedef struct godot_gdnative_core_1_1_api_struct {
+    unsigned int type;
+    godot_gdnative_api_version version;
+    const godot_gdnative_api_struct *next;
+    godot_variant (*godot_dictionary_get_with_default)(const godot_dictionary *p_self, const godot_variant *p_key, const godot_variant *p_default);
+} godot_gdnative_core_1_1_api_struct;
+
+typedef struct godot_gdnative_ext_nativescript_api_struct {
+    unsigned int type;
+    godot_gdnative_api_version version;
+    const godot_gdnative_api_struct *next;
+    void (*godot_nativescript_register_class)(void *p_gdnative_handle, const char *p_name, const char *p_base, godot_instance_create_func p_create_func, godot_instance_destroy_func p_destroy_func);
+    void (*godot_nativescript_register_tool_class)(void *p_gdnative_handle, const char *p_name, const char *p_base, godot_instance_create_func p_create_func, godot_instance_destroy_func p_destroy_func);
+    void (*godot_nativescript_register_method)(void *p_gdnative_handle, const char *p_name, const char *p_function_name, godot_method_attributes p_attr, godot_instance_method p_method);
+    void (*godot_nativescript_register_property)(void *p_gdnative_handle, const char *p_name, const char *p_path, godot_property_attributes *p_attr, godot_property_set_func p_set_func, godot_property_get_func p_get_func);
+    void (*godot_nativescript_register_signal)(void *p_gdnative_handle, const char *p_name, const godot_signal *p_signal);
+    void *(*godot_nativescript_get_userdata)(godot_object *p_instance);
+} godot_gdnative_ext_nativescript_api_struct;
+
+typedef struct godot_gdnative_ext_nativescript_1_1_api_struct {
+    unsigned int type;
+    godot_gdnative_api_version version;
+    const godot_gdnative_api_struct *next;
+    void (*godot_nativescript_set_method_argument_information)(void *p_gdnative_handle, const char *p_name, const char *p_function_name, int p_num_args, const godot_method_arg *p_args);
+    void (*godot_nativescript_set_class_documentation)(void *p_gdnative_handle, const char *p_name, godot_string p_documentation);
+    void (*godot_nativescript_set_method_documentation)(void *p_gdnative_handle, const char *p_name, const char *p_function_name, godot_string p_documentation);
+    void (*godot_nativescript_set_property_documentation)(void *p_gdnative_handle, const char *p_name, const char *p_path, godot_string p_documentation);
+    void (*godot_nativescript_set_signal_documentation)(void *p_gdnative_handle, const char *p_name, const char *p_signal_name, godot_string p_documentation);
+} godot_gdnative_ext_nativescript_1_1_api_struct;
+
+// Extensions without entries used by HGDN
+#define GDNATIVE_STUB_EMPTY_API_STRUCT(name) \
+    typedef struct name { \
+        unsigned int type; \
+        godot_gdnative_api_version version; \
+        const godot_gdnative_api_struct *next; \
+    } name;
+
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_core_1_2_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_core_1_3_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_pluginscript_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_android_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_arvr_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_arvr_1_2_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_videodecoder_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_net_api_struct)
+GDNATIVE_STUB_EMPTY_API_STRUCT(godot_gdnative_ext_net_3_2_api_struct)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // GDNATIVE_API_STRUCT_GEN_H
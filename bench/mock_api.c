@@ -0,0 +1,1622 @@
+#include "mock_api.h"
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+// Memory
+static _Thread_local mock_alloc_stats mock__alloc_stats;
+
+static void *mock__alloc(size_t size) {
+    mock__alloc_stats.allocs++;
+    mock__alloc_stats.bytes += size;
+    void *ptr = malloc(size ? size : 1);
+    if (ptr == NULL) {
+        fprintf(stderr, "mock: out of memory allocating %zu bytes\n", size);
+        abort();
+    }
+    return ptr;
+}
+
+static void *mock__realloc(void *ptr, size_t size) {
+    mock__alloc_stats.allocs++;
+    mock__alloc_stats.bytes += size;
+    ptr = realloc(ptr, size ? size : 1);
+    if (ptr == NULL) {
+        fprintf(stderr, "mock: out of memory reallocating %zu bytes\n", size);
+        abort();
+    }
+    return ptr;
+}
+
+static void mock__free(void *ptr) {
+    free(ptr);
+}
+
+static void mock__fail(const char *function, const char *message) {
+    fprintf(stderr, "mock: %s: %s\n", function, message);
+    abort();
+}
+
+#define MOCK_CHECK_INDEX(index, size) \
+    if ((index) < 0 || (index) >= (size)) { \
+        mock__fail(__func__, "index out of bounds"); \
+    }
+
+// Opaque types hold a single pointer to their data, accessed with memcpy to avoid alignment issues
+static void *mock__get_ptr(const void *opaque) {
+    void *ptr;
+    memcpy(&ptr, opaque, sizeof(ptr));
+    return ptr;
+}
+
+static void mock__set_ptr(void *opaque, const void *ptr) {
+    memcpy(opaque, &ptr, sizeof(ptr));
+}
+
+// Reference counting, the counter must be the first field of counted data
+typedef struct mock_ref {
+    atomic_int refcount;
+} mock_ref;
+
+static void *mock__ref_init(void *ptr) {
+    atomic_init(&((mock_ref *) ptr)->refcount, 1);
+    return ptr;
+}
+
+static void *mock__ref(void *ptr) {
+    if (ptr) {
+        atomic_fetch_add_explicit(&((mock_ref *) ptr)->refcount, 1, memory_order_relaxed);
+    }
+    return ptr;
+}
+
+// Returns true if this was the last reference and data should be freed
+static godot_bool mock__unref(void *ptr) {
+    return ptr && atomic_fetch_sub_explicit(&((mock_ref *) ptr)->refcount, 1, memory_order_acq_rel) == 1;
+}
+
+static godot_bool mock__is_shared(const void *ptr) {
+    return ptr && atomic_load_explicit(&((mock_ref *) ptr)->refcount, memory_order_acquire) > 1;
+}
+
+// UTF-8, with `out` NULL only counting the output size. Invalid sequences become U+FFFD.
+static godot_int mock__utf8_decode(wchar_t *out, const char *str, godot_int len) {
+    const uint8_t *s = (const uint8_t *) str;
+    godot_int count = 0;
+    godot_int i = 0;
+    while (i < len && s[i]) {
+        uint32_t c = s[i];
+        int extra = c < 0x80 ? 0 : (c & 0xE0) == 0xC0 ? 1 : (c & 0xF0) == 0xE0 ? 2 : (c & 0xF8) == 0xF0 ? 3 : -1;
+        if (extra < 0 || i + extra >= len + (extra == 0)) {
+            c = 0xFFFD;
+            extra = 0;
+        }
+        else if (extra > 0) {
+            c &= 0x3F >> extra;
+            for (int j = 1; j <= extra; j++) {
+                if ((s[i + j] & 0xC0) != 0x80) {
+                    c = 0xFFFD;
+                    extra = 0;
+                    break;
+                }
+                c = (c << 6) | (s[i + j] & 0x3F);
+            }
+        }
+        i += extra + 1;
+#if WCHAR_MAX <= 0xFFFF
+        if (c >= 0x10000) {
+            if (out) {
+                out[count] = (wchar_t) (0xD800 + ((c - 0x10000) >> 10));
+                out[count + 1] = (wchar_t) (0xDC00 + ((c - 0x10000) & 0x3FF));
+            }
+            count += 2;
+            continue;
+        }
+#endif
+        if (out) {
+            out[count] = (wchar_t) c;
+        }
+        count++;
+    }
+    return count;
+}
+
+static godot_int mock__utf8_encode(char *out, const wchar_t *chars, godot_int length) {
+    godot_int size = 0;
+    for (godot_int i = 0; i < length; i++) {
+        uint32_t c = (uint32_t) chars[i];
+#if WCHAR_MAX <= 0xFFFF
+        if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && chars[i + 1] >= 0xDC00 && chars[i + 1] <= 0xDFFF) {
+            c = 0x10000 + ((c - 0xD800) << 10) + ((uint32_t) chars[i + 1] - 0xDC00);
+            i++;
+        }
+#endif
+        uint8_t bytes[4];
+        int n;
+        if (c < 0x80) {
+            bytes[0] = (uint8_t) c;
+            n = 1;
+        }
+        else if (c < 0x800) {
+            bytes[0] = (uint8_t) (0xC0 | (c >> 6));
+            bytes[1] = (uint8_t) (0x80 | (c & 0x3F));
+            n = 2;
+        }
+        else if (c < 0x10000) {
+            bytes[0] = (uint8_t) (0xE0 | (c >> 12));
+            bytes[1] = (uint8_t) (0x80 | ((c >> 6) & 0x3F));
+            bytes[2] = (uint8_t) (0x80 | (c & 0x3F));
+            n = 3;
+        }
+        else {
+            bytes[0] = (uint8_t) (0xF0 | (c >> 18));
+            bytes[1] = (uint8_t) (0x80 | ((c >> 12) & 0x3F));
+            bytes[2] = (uint8_t) (0x80 | ((c >> 6) & 0x3F));
+            bytes[3] = (uint8_t) (0x80 | (c & 0x3F));
+            n = 4;
+        }
+        if (out) {
+            memcpy(out + size, bytes, n);
+        }
+        size += n;
+    }
+    return size;
+}
+
+// Strings: NULL data is the empty String, like in Godot
+typedef struct mock_string_data {
+    mock_ref ref;
+    godot_int length;
+    wchar_t chars[];
+} mock_string_data;
+
+static mock_string_data *mock__string_data(const godot_string *str) {
+    return (mock_string_data *) mock__get_ptr(str);
+}
+
+static mock_string_data *mock__string_data_new(godot_int length) {
+    mock_string_data *data = (mock_string_data *) mock__ref_init(mock__alloc(sizeof(mock_string_data) + (length + 1) * sizeof(wchar_t)));
+    data->length = length;
+    data->chars[length] = 0;
+    return data;
+}
+
+static void mock__string_unref(mock_string_data *data) {
+    if (mock__unref(data)) {
+        mock__free(data);
+    }
+}
+
+static void mock__string_init(godot_string *r_dest, const wchar_t *chars, godot_int length) {
+    mock_string_data *data = NULL;
+    if (length > 0) {
+        data = mock__string_data_new(length);
+        memcpy(data->chars, chars, length * sizeof(wchar_t));
+    }
+    mock__set_ptr(r_dest, data);
+}
+
+static void mock__string_init_utf8(godot_string *r_dest, const char *utf8, godot_int len) {
+    // Count first, then decode, like Godot's `String::parse_utf8`
+    godot_int length = mock__utf8_decode(NULL, utf8, len);
+    mock_string_data *data = NULL;
+    if (length > 0) {
+        data = mock__string_data_new(length);
+        mock__utf8_decode(data->chars, utf8, len);
+    }
+    mock__set_ptr(r_dest, data);
+}
+
+static void mock__string_init_cstring(godot_string *r_dest, const char *cstr) {
+    mock__string_init_utf8(r_dest, cstr, (godot_int) strlen(cstr));
+}
+
+static uint32_t mock__string_hash_chars(const wchar_t *chars, godot_int length) {
+    // djb2, like Godot's `String::hash`
+    uint32_t hash = 5381;
+    for (godot_int i = 0; i < length; i++) {
+        hash = ((hash << 5) + hash) + (uint32_t) chars[i];
+    }
+    return hash;
+}
+
+static godot_bool mock__string_equals_cstring(const godot_string *str, const char *cstr) {
+    mock_string_data *data = mock__string_data(str);
+    godot_int length = data ? data->length : 0;
+    for (godot_int i = 0; i < length; i++) {
+        if (cstr[i] == '\0' || (wchar_t) (unsigned char) cstr[i] != data->chars[i]) {
+            return 0;
+        }
+    }
+    return cstr[length] == '\0';
+}
+
+static void mock_string_new(godot_string *r_dest) {
+    mock__set_ptr(r_dest, NULL);
+}
+
+static void mock_string_new_copy(godot_string *r_dest, const godot_string *p_src) {
+    mock__set_ptr(r_dest, mock__ref(mock__string_data(p_src)));
+}
+
+static void mock_string_new_with_wide_string(godot_string *r_dest, const wchar_t *p_contents, const int p_size) {
+    // Stops at the first NULL character, like Godot's `String::copy_from`
+    godot_int length = 0;
+    while ((p_size < 0 || length < p_size) && p_contents[length]) {
+        length++;
+    }
+    mock__string_init(r_dest, p_contents, length);
+}
+
+static wchar_t *mock_string_operator_index(godot_string *p_self, const godot_int p_idx) {
+    mock_string_data *data = mock__string_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data ? data->length : 0);
+    if (mock__is_shared(data)) {
+        mock__string_init(p_self, data->chars, data->length);
+        mock__string_unref(data);
+        data = mock__string_data(p_self);
+    }
+    return &data->chars[p_idx];
+}
+
+static wchar_t mock_string_operator_index_const(const godot_string *p_self, const godot_int p_idx) {
+    mock_string_data *data = mock__string_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data ? data->length : 0);
+    return data->chars[p_idx];
+}
+
+static const wchar_t *mock_string_wide_str(const godot_string *p_self) {
+    mock_string_data *data = mock__string_data(p_self);
+    return data ? data->chars : L"";
+}
+
+static godot_int mock_string_length(const godot_string *p_self) {
+    mock_string_data *data = mock__string_data(p_self);
+    return data ? data->length : 0;
+}
+
+static godot_string mock_string_chars_to_utf8(const char *p_utf8) {
+    godot_string str;
+    mock__string_init_cstring(&str, p_utf8);
+    return str;
+}
+
+static godot_string mock_string_chars_to_utf8_with_len(const char *p_utf8, godot_int p_len) {
+    godot_string str;
+    mock__string_init_utf8(&str, p_utf8, p_len);
+    return str;
+}
+
+static uint32_t mock_string_hash(const godot_string *p_self) {
+    return mock__string_hash_chars(mock_string_wide_str(p_self), mock_string_length(p_self));
+}
+
+static godot_bool mock_string_operator_equal(const godot_string *p_self, const godot_string *p_b) {
+    godot_int length = mock_string_length(p_self);
+    return length == mock_string_length(p_b)
+        && wmemcmp(mock_string_wide_str(p_self), mock_string_wide_str(p_b), length) == 0;
+}
+
+static void mock_string_destroy(godot_string *p_self) {
+    mock__string_unref(mock__string_data(p_self));
+}
+
+// CharStrings
+typedef struct mock_char_string_data {
+    godot_int length;
+    char chars[];
+} mock_char_string_data;
+
+static godot_char_string mock_string_utf8(const godot_string *p_self) {
+    // Measure first, then allocate once, like Godot's `String::utf8`
+    const wchar_t *chars = mock_string_wide_str(p_self);
+    godot_int length = mock_string_length(p_self);
+    godot_int size = mock__utf8_encode(NULL, chars, length);
+    mock_char_string_data *data = (mock_char_string_data *) mock__alloc(sizeof(mock_char_string_data) + size + 1);
+    mock__utf8_encode(data->chars, chars, length);
+    data->chars[size] = '\0';
+    data->length = size;
+    godot_char_string char_string;
+    mock__set_ptr(&char_string, data);
+    return char_string;
+}
+
+static godot_int mock_char_string_length(const godot_char_string *p_cs) {
+    return ((mock_char_string_data *) mock__get_ptr(p_cs))->length;
+}
+
+static const char *mock_char_string_get_data(const godot_char_string *p_cs) {
+    return ((mock_char_string_data *) mock__get_ptr(p_cs))->chars;
+}
+
+static void mock_char_string_destroy(godot_char_string *p_cs) {
+    mock__free(mock__get_ptr(p_cs));
+}
+
+// StringNames
+typedef struct mock_string_name_data {
+    mock_ref ref;
+    uint32_t hash;
+    godot_string name;
+} mock_string_name_data;
+
+static mock_string_name_data *mock__string_name_data(const godot_string_name *name) {
+    return (mock_string_name_data *) mock__get_ptr(name);
+}
+
+static void mock_string_name_new(godot_string_name *r_dest, const godot_string *p_name) {
+    mock_string_name_data *data = (mock_string_name_data *) mock__ref_init(mock__alloc(sizeof(mock_string_name_data)));
+    mock_string_new_copy(&data->name, p_name);
+    data->hash = mock_string_hash(p_name);
+    mock__set_ptr(r_dest, data);
+}
+
+static void mock_string_name_new_data(godot_string_name *r_dest, const char *p_name) {
+    godot_string name;
+    mock__string_init_cstring(&name, p_name);
+    mock_string_name_new(r_dest, &name);
+    mock_string_destroy(&name);
+}
+
+static godot_string mock_string_name_get_name(const godot_string_name *p_self) {
+    godot_string name;
+    mock_string_new_copy(&name, &mock__string_name_data(p_self)->name);
+    return name;
+}
+
+static uint32_t mock_string_name_get_hash(const godot_string_name *p_self) {
+    return mock__string_name_data(p_self)->hash;
+}
+
+static const void *mock_string_name_get_data_unique_pointer(const godot_string_name *p_self) {
+    return mock__string_name_data(p_self);
+}
+
+static void mock_string_name_destroy(godot_string_name *p_self) {
+    mock_string_name_data *data = mock__string_name_data(p_self);
+    if (mock__unref(data)) {
+        mock_string_destroy(&data->name);
+        mock__free(data);
+    }
+}
+
+// NodePaths, only wrapping their String
+typedef struct mock_node_path_data {
+    mock_ref ref;
+    godot_string path;
+} mock_node_path_data;
+
+static void mock_node_path_new(godot_node_path *r_dest, const godot_string *p_from) {
+    mock_node_path_data *data = NULL;
+    if (mock_string_length(p_from) > 0) {
+        data = (mock_node_path_data *) mock__ref_init(mock__alloc(sizeof(mock_node_path_data)));
+        mock_string_new_copy(&data->path, p_from);
+    }
+    mock__set_ptr(r_dest, data);
+}
+
+static godot_string mock_node_path_as_string(const godot_node_path *p_self) {
+    godot_string str;
+    mock_node_path_data *data = (mock_node_path_data *) mock__get_ptr(p_self);
+    if (data) {
+        mock_string_new_copy(&str, &data->path);
+    }
+    else {
+        mock_string_new(&str);
+    }
+    return str;
+}
+
+static void mock_node_path_destroy(godot_node_path *p_self) {
+    mock_node_path_data *data = (mock_node_path_data *) mock__get_ptr(p_self);
+    if (mock__unref(data)) {
+        mock_string_destroy(&data->path);
+        mock__free(data);
+    }
+}
+
+// Variants: up to 16 bytes of data are stored inline, bigger math types are boxed
+typedef struct mock_variant {
+    godot_variant_type type;
+    union {
+        godot_bool b;
+        int64_t i;
+        double r;
+        void *ptr;
+        uint8_t inline_data[16];
+    } as;
+} mock_variant;
+
+typedef char mock__variant_fits[sizeof(mock_variant) <= sizeof(godot_variant) ? 1 : -1];
+
+static mock_variant mock__variant_read(const godot_variant *var) {
+    mock_variant v;
+    memcpy(&v, var, sizeof(v));
+    return v;
+}
+
+static void mock__variant_write(godot_variant *var, mock_variant v) {
+    memset(var, 0, sizeof(godot_variant));
+    memcpy(var, &v, sizeof(v));
+}
+
+static size_t mock__variant_data_size(godot_variant_type type) {
+    switch (type) {
+        case GODOT_VARIANT_TYPE_VECTOR2: return sizeof(godot_vector2);
+        case GODOT_VARIANT_TYPE_RECT2: return sizeof(godot_rect2);
+        case GODOT_VARIANT_TYPE_VECTOR3: return sizeof(godot_vector3);
+        case GODOT_VARIANT_TYPE_PLANE: return sizeof(godot_plane);
+        case GODOT_VARIANT_TYPE_QUAT: return sizeof(godot_quat);
+        case GODOT_VARIANT_TYPE_COLOR: return sizeof(godot_color);
+        case GODOT_VARIANT_TYPE_RID: return sizeof(godot_rid);
+        case GODOT_VARIANT_TYPE_TRANSFORM2D: return sizeof(godot_transform2d);
+        case GODOT_VARIANT_TYPE_AABB: return sizeof(godot_aabb);
+        case GODOT_VARIANT_TYPE_BASIS: return sizeof(godot_basis);
+        case GODOT_VARIANT_TYPE_TRANSFORM: return sizeof(godot_transform);
+        default: return 0;
+    }
+}
+
+static godot_bool mock__variant_is_boxed(godot_variant_type type) {
+    return type == GODOT_VARIANT_TYPE_TRANSFORM2D
+        || type == GODOT_VARIANT_TYPE_AABB
+        || type == GODOT_VARIANT_TYPE_BASIS
+        || type == GODOT_VARIANT_TYPE_TRANSFORM;
+}
+
+static godot_bool mock__variant_is_pool(godot_variant_type type) {
+    return type >= GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY && type <= GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY;
+}
+
+static const void *mock__variant_data_ptr(const mock_variant *v) {
+    return mock__variant_is_boxed(v->type) ? v->as.ptr : (const void *) v->as.inline_data;
+}
+
+static void mock__array_unref(void *data);
+static void mock__dictionary_unref(void *data);
+static void mock__pool_unref(void *data);
+
+static void mock_variant_destroy(godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    switch (v.type) {
+        case GODOT_VARIANT_TYPE_STRING:
+            mock__string_unref((mock_string_data *) v.as.ptr);
+            break;
+        case GODOT_VARIANT_TYPE_NODE_PATH:
+            mock_node_path_destroy((godot_node_path *) &v.as.ptr);
+            break;
+        case GODOT_VARIANT_TYPE_ARRAY:
+            mock__array_unref(v.as.ptr);
+            break;
+        case GODOT_VARIANT_TYPE_DICTIONARY:
+            mock__dictionary_unref(v.as.ptr);
+            break;
+        default:
+            if (mock__variant_is_boxed(v.type)) {
+                mock__free(v.as.ptr);
+            }
+            else if (mock__variant_is_pool(v.type)) {
+                mock__pool_unref(v.as.ptr);
+            }
+            break;
+    }
+}
+
+static void mock_variant_new_copy(godot_variant *r_dest, const godot_variant *p_src) {
+    mock_variant v = mock__variant_read(p_src);
+    if (mock__variant_is_boxed(v.type)) {
+        size_t size = mock__variant_data_size(v.type);
+        void *box = mock__alloc(size);
+        memcpy(box, v.as.ptr, size);
+        v.as.ptr = box;
+    }
+    else if (v.type == GODOT_VARIANT_TYPE_STRING
+             || v.type == GODOT_VARIANT_TYPE_NODE_PATH
+             || v.type == GODOT_VARIANT_TYPE_ARRAY
+             || v.type == GODOT_VARIANT_TYPE_DICTIONARY
+             || mock__variant_is_pool(v.type)) {
+        mock__ref(v.as.ptr);
+    }
+    mock__variant_write(r_dest, v);
+}
+
+static godot_variant_type mock_variant_get_type(const godot_variant *p_v) {
+    return mock__variant_read(p_v).type;
+}
+
+static void mock_variant_new_nil(godot_variant *r_dest) {
+    mock_variant v = { .type = GODOT_VARIANT_TYPE_NIL };
+    mock__variant_write(r_dest, v);
+}
+
+static void mock_variant_new_bool(godot_variant *r_dest, const godot_bool p_b) {
+    mock_variant v = { .type = GODOT_VARIANT_TYPE_BOOL };
+    v.as.b = p_b;
+    mock__variant_write(r_dest, v);
+}
+
+static void mock_variant_new_int(godot_variant *r_dest, const int64_t p_i) {
+    mock_variant v = { .type = GODOT_VARIANT_TYPE_INT };
+    v.as.i = p_i;
+    mock__variant_write(r_dest, v);
+}
+
+static void mock_variant_new_uint(godot_variant *r_dest, const uint64_t p_i) {
+    mock_variant_new_int(r_dest, (int64_t) p_i);
+}
+
+static void mock_variant_new_real(godot_variant *r_dest, const double p_r) {
+    mock_variant v = { .type = GODOT_VARIANT_TYPE_REAL };
+    v.as.r = p_r;
+    mock__variant_write(r_dest, v);
+}
+
+static void mock_variant_new_object(godot_variant *r_dest, const godot_object *p_obj) {
+    mock_variant v = { .type = GODOT_VARIANT_TYPE_OBJECT };
+    v.as.ptr = (void *) p_obj;
+    mock__variant_write(r_dest, v);
+}
+
+static void mock__variant_new_ref(godot_variant *r_dest, godot_variant_type type, const void *opaque) {
+    mock_variant v = { .type = type };
+    v.as.ptr = mock__ref(mock__get_ptr(opaque));
+    mock__variant_write(r_dest, v);
+}
+
+static void mock_variant_new_string(godot_variant *r_dest, const godot_string *p_s) {
+    mock__variant_new_ref(r_dest, GODOT_VARIANT_TYPE_STRING, p_s);
+}
+
+static void mock_variant_new_node_path(godot_variant *r_dest, const godot_node_path *p_np) {
+    mock__variant_new_ref(r_dest, GODOT_VARIANT_TYPE_NODE_PATH, p_np);
+}
+
+static void mock_variant_new_array(godot_variant *r_dest, const godot_array *p_arr) {
+    mock__variant_new_ref(r_dest, GODOT_VARIANT_TYPE_ARRAY, p_arr);
+}
+
+static void mock_variant_new_dictionary(godot_variant *r_dest, const godot_dictionary *p_dict) {
+    mock__variant_new_ref(r_dest, GODOT_VARIANT_TYPE_DICTIONARY, p_dict);
+}
+
+static godot_bool mock_variant_as_bool(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    switch (v.type) {
+        case GODOT_VARIANT_TYPE_NIL: return 0;
+        case GODOT_VARIANT_TYPE_BOOL: return v.as.b;
+        case GODOT_VARIANT_TYPE_INT: return v.as.i != 0;
+        case GODOT_VARIANT_TYPE_REAL: return v.as.r != 0;
+        case GODOT_VARIANT_TYPE_STRING: return v.as.ptr != NULL;
+        default: return 1;
+    }
+}
+
+static int64_t mock_variant_as_int(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    switch (v.type) {
+        case GODOT_VARIANT_TYPE_BOOL: return v.as.b;
+        case GODOT_VARIANT_TYPE_INT: return v.as.i;
+        case GODOT_VARIANT_TYPE_REAL: return (int64_t) v.as.r;
+        case GODOT_VARIANT_TYPE_STRING: return v.as.ptr ? wcstoll(((mock_string_data *) v.as.ptr)->chars, NULL, 10) : 0;
+        default: return 0;
+    }
+}
+
+static uint64_t mock_variant_as_uint(const godot_variant *p_self) {
+    return (uint64_t) mock_variant_as_int(p_self);
+}
+
+static double mock_variant_as_real(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    switch (v.type) {
+        case GODOT_VARIANT_TYPE_BOOL: return v.as.b;
+        case GODOT_VARIANT_TYPE_INT: return (double) v.as.i;
+        case GODOT_VARIANT_TYPE_REAL: return v.as.r;
+        case GODOT_VARIANT_TYPE_STRING: return v.as.ptr ? wcstod(((mock_string_data *) v.as.ptr)->chars, NULL) : 0;
+        default: return 0;
+    }
+}
+
+static godot_object *mock_variant_as_object(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    return v.type == GODOT_VARIANT_TYPE_OBJECT ? (godot_object *) v.as.ptr : NULL;
+}
+
+static godot_string mock_variant_as_string(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    godot_string str;
+    char buffer[64];
+    switch (v.type) {
+        case GODOT_VARIANT_TYPE_STRING:
+            mock__set_ptr(&str, mock__ref(v.as.ptr));
+            return str;
+        case GODOT_VARIANT_TYPE_NODE_PATH:
+            return mock_node_path_as_string((const godot_node_path *) &v.as.ptr);
+        case GODOT_VARIANT_TYPE_NIL:
+            strcpy(buffer, "Null");
+            break;
+        case GODOT_VARIANT_TYPE_BOOL:
+            strcpy(buffer, v.as.b ? "True" : "False");
+            break;
+        case GODOT_VARIANT_TYPE_INT:
+            snprintf(buffer, sizeof(buffer), "%lld", (long long) v.as.i);
+            break;
+        case GODOT_VARIANT_TYPE_REAL:
+            snprintf(buffer, sizeof(buffer), "%.14g", v.as.r);
+            break;
+        default:
+            snprintf(buffer, sizeof(buffer), "[Variant:%d]", (int) v.type);
+            break;
+    }
+    mock__string_init_cstring(&str, buffer);
+    return str;
+}
+
+static godot_node_path mock_variant_as_node_path(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    godot_node_path path;
+    if (v.type == GODOT_VARIANT_TYPE_NODE_PATH) {
+        mock__set_ptr(&path, mock__ref(v.as.ptr));
+    }
+    else if (v.type == GODOT_VARIANT_TYPE_STRING) {
+        mock_node_path_new(&path, (const godot_string *) &v.as.ptr);
+    }
+    else {
+        mock__set_ptr(&path, NULL);
+    }
+    return path;
+}
+
+#define MOCK_MATH_VARIANT_API(kind, ctype, variant_type) \
+    static void mock_variant_new_##kind(godot_variant *r_dest, const ctype *p_value) { \
+        mock_variant v = { .type = variant_type }; \
+        if (mock__variant_is_boxed(variant_type)) { \
+            v.as.ptr = mock__alloc(sizeof(ctype)); \
+            memcpy(v.as.ptr, p_value, sizeof(ctype)); \
+        } \
+        else { \
+            memcpy(v.as.inline_data, p_value, sizeof(ctype)); \
+        } \
+        mock__variant_write(r_dest, v); \
+    } \
+    static ctype mock_variant_as_##kind(const godot_variant *p_self) { \
+        mock_variant v = mock__variant_read(p_self); \
+        ctype value; \
+        memset(&value, 0, sizeof(value)); \
+        if (v.type == variant_type) { \
+            memcpy(&value, mock__variant_data_ptr(&v), sizeof(ctype)); \
+        } \
+        return value; \
+    }
+
+MOCK_MATH_VARIANT_API(vector2, godot_vector2, GODOT_VARIANT_TYPE_VECTOR2)
+MOCK_MATH_VARIANT_API(rect2, godot_rect2, GODOT_VARIANT_TYPE_RECT2)
+MOCK_MATH_VARIANT_API(vector3, godot_vector3, GODOT_VARIANT_TYPE_VECTOR3)
+MOCK_MATH_VARIANT_API(transform2d, godot_transform2d, GODOT_VARIANT_TYPE_TRANSFORM2D)
+MOCK_MATH_VARIANT_API(plane, godot_plane, GODOT_VARIANT_TYPE_PLANE)
+MOCK_MATH_VARIANT_API(quat, godot_quat, GODOT_VARIANT_TYPE_QUAT)
+MOCK_MATH_VARIANT_API(aabb, godot_aabb, GODOT_VARIANT_TYPE_AABB)
+MOCK_MATH_VARIANT_API(basis, godot_basis, GODOT_VARIANT_TYPE_BASIS)
+MOCK_MATH_VARIANT_API(transform, godot_transform, GODOT_VARIANT_TYPE_TRANSFORM)
+MOCK_MATH_VARIANT_API(color, godot_color, GODOT_VARIANT_TYPE_COLOR)
+MOCK_MATH_VARIANT_API(rid, godot_rid, GODOT_VARIANT_TYPE_RID)
+
+static uint32_t mock__hash_bytes(const void *data, size_t size) {
+    const uint8_t *bytes = (const uint8_t *) data;
+    uint32_t hash = 5381;
+    for (size_t i = 0; i < size; i++) {
+        hash = ((hash << 5) + hash) + bytes[i];
+    }
+    return hash;
+}
+
+// Used for Dictionary keys, like Godot's `Variant::hash`
+static uint32_t mock__variant_hash(const mock_variant *v) {
+    switch (v->type) {
+        case GODOT_VARIANT_TYPE_NIL:
+            return 0;
+        case GODOT_VARIANT_TYPE_BOOL:
+            return v->as.b ? 1 : 0;
+        case GODOT_VARIANT_TYPE_INT:
+            return mock__hash_bytes(&v->as.i, sizeof(v->as.i));
+        case GODOT_VARIANT_TYPE_REAL:
+            return mock__hash_bytes(&v->as.r, sizeof(v->as.r));
+        case GODOT_VARIANT_TYPE_STRING:
+            return v->as.ptr ? mock__string_hash_chars(((mock_string_data *) v->as.ptr)->chars, ((mock_string_data *) v->as.ptr)->length) : 5381;
+        default: {
+            size_t size = mock__variant_data_size(v->type);
+            return size ? mock__hash_bytes(mock__variant_data_ptr(v), size) : mock__hash_bytes(&v->as.ptr, sizeof(v->as.ptr));
+        }
+    }
+}
+
+static godot_bool mock__variant_hash_compare(const mock_variant *a, const mock_variant *b) {
+    if (a->type != b->type) {
+        return 0;
+    }
+    switch (a->type) {
+        case GODOT_VARIANT_TYPE_NIL:
+            return 1;
+        case GODOT_VARIANT_TYPE_BOOL:
+            return a->as.b == b->as.b;
+        case GODOT_VARIANT_TYPE_INT:
+            return a->as.i == b->as.i;
+        case GODOT_VARIANT_TYPE_REAL:
+            return a->as.r == b->as.r;
+        case GODOT_VARIANT_TYPE_STRING:
+            return mock_string_operator_equal((const godot_string *) &a->as.ptr, (const godot_string *) &b->as.ptr);
+        default: {
+            size_t size = mock__variant_data_size(a->type);
+            return size ? memcmp(mock__variant_data_ptr(a), mock__variant_data_ptr(b), size) == 0 : a->as.ptr == b->as.ptr;
+        }
+    }
+}
+
+static godot_bool mock_variant_hash_compare(const godot_variant *p_self, const godot_variant *p_other) {
+    mock_variant a = mock__variant_read(p_self), b = mock__variant_read(p_other);
+    return mock__variant_hash_compare(&a, &b);
+}
+
+static godot_bool mock_variant_operator_equal(const godot_variant *p_self, const godot_variant *p_other) {
+    mock_variant a = mock__variant_read(p_self), b = mock__variant_read(p_other);
+    if ((a.type == GODOT_VARIANT_TYPE_INT || a.type == GODOT_VARIANT_TYPE_REAL)
+        && (b.type == GODOT_VARIANT_TYPE_INT || b.type == GODOT_VARIANT_TYPE_REAL)) {
+        return mock_variant_as_real(p_self) == mock_variant_as_real(p_other);
+    }
+    return mock__variant_hash_compare(&a, &b);
+}
+
+// Arrays are shared by reference, like in Godot
+typedef struct mock_array_data {
+    mock_ref ref;
+    godot_int size;
+    godot_int capacity;
+    godot_variant *items;
+} mock_array_data;
+
+static mock_array_data *mock__array_data(const godot_array *array) {
+    return (mock_array_data *) mock__get_ptr(array);
+}
+
+static void mock__array_reserve(mock_array_data *data, godot_int size) {
+    if (size > data->capacity) {
+        godot_int capacity = data->capacity ? data->capacity : 1;
+        while (capacity < size) {
+            capacity *= 2;
+        }
+        data->items = (godot_variant *) mock__realloc(data->items, capacity * sizeof(godot_variant));
+        data->capacity = capacity;
+    }
+}
+
+static void mock__array_unref(void *ptr) {
+    mock_array_data *data = (mock_array_data *) ptr;
+    if (mock__unref(data)) {
+        for (godot_int i = 0; i < data->size; i++) {
+            mock_variant_destroy(&data->items[i]);
+        }
+        mock__free(data->items);
+        mock__free(data);
+    }
+}
+
+static void mock_array_new(godot_array *r_dest) {
+    mock_array_data *data = (mock_array_data *) mock__ref_init(mock__alloc(sizeof(mock_array_data)));
+    data->size = data->capacity = 0;
+    data->items = NULL;
+    mock__set_ptr(r_dest, data);
+}
+
+static void mock_array_new_copy(godot_array *r_dest, const godot_array *p_src) {
+    mock__set_ptr(r_dest, mock__ref(mock__array_data(p_src)));
+}
+
+static void mock_array_set(godot_array *p_self, const godot_int p_idx, const godot_variant *p_value) {
+    mock_array_data *data = mock__array_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data->size);
+    godot_variant copy;
+    mock_variant_new_copy(&copy, p_value);
+    mock_variant_destroy(&data->items[p_idx]);
+    data->items[p_idx] = copy;
+}
+
+static godot_variant mock_array_get(const godot_array *p_self, const godot_int p_idx) {
+    mock_array_data *data = mock__array_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data->size);
+    godot_variant value;
+    mock_variant_new_copy(&value, &data->items[p_idx]);
+    return value;
+}
+
+static godot_variant *mock_array_operator_index(godot_array *p_self, const godot_int p_idx) {
+    mock_array_data *data = mock__array_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data->size);
+    return &data->items[p_idx];
+}
+
+static const godot_variant *mock_array_operator_index_const(const godot_array *p_self, const godot_int p_idx) {
+    mock_array_data *data = mock__array_data(p_self);
+    MOCK_CHECK_INDEX(p_idx, data->size);
+    return &data->items[p_idx];
+}
+
+static void mock_array_append(godot_array *p_self, const godot_variant *p_value) {
+    mock_array_data *data = mock__array_data(p_self);
+    mock__array_reserve(data, data->size + 1);
+    mock_variant_new_copy(&data->items[data->size++], p_value);
+}
+
+static void mock_array_resize(godot_array *p_self, const godot_int p_size) {
+    mock_array_data *data = mock__array_data(p_self);
+    if (p_size < 0) {
+        mock__fail(__func__, "negative size");
+    }
+    for (godot_int i = p_size; i < data->size; i++) {
+        mock_variant_destroy(&data->items[i]);
+    }
+    if (p_size == 0) {
+        mock__free(data->items);
+        data->items = NULL;
+        data->capacity = 0;
+    }
+    else {
+        mock__array_reserve(data, p_size);
+        for (godot_int i = data->size; i < p_size; i++) {
+            mock_variant_new_nil(&data->items[i]);
+        }
+    }
+    data->size = p_size;
+}
+
+static void mock_array_clear(godot_array *p_self) {
+    mock_array_resize(p_self, 0);
+}
+
+static godot_int mock_array_size(const godot_array *p_self) {
+    return mock__array_data(p_self)->size;
+}
+
+static void mock_array_destroy(godot_array *p_self) {
+    mock__array_unref(mock__array_data(p_self));
+}
+
+static godot_array mock_variant_as_array(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    godot_array array;
+    if (v.type == GODOT_VARIANT_TYPE_ARRAY) {
+        mock__set_ptr(&array, mock__ref(v.as.ptr));
+    }
+    else {
+        mock_array_new(&array);
+    }
+    return array;
+}
+
+// Dictionaries are shared by reference and keep insertion order, with one node per entry, like Godot's OrderedHashMap
+typedef struct mock_dictionary_entry {
+    godot_variant key;  // First field, so that `godot_dictionary_next` can return a pointer to it
+    godot_variant value;
+    uint32_t hash;
+    struct mock_dictionary_entry *next;
+    struct mock_dictionary_entry *prev;
+    struct mock_dictionary_entry *bucket_next;
+} mock_dictionary_entry;
+
+typedef struct mock_dictionary_data {
+    mock_ref ref;
+    godot_int size;
+    uint32_t bucket_count;
+    mock_dictionary_entry **buckets;
+    mock_dictionary_entry *first;
+    mock_dictionary_entry *last;
+} mock_dictionary_data;
+
+static mock_dictionary_data *mock__dictionary_data(const godot_dictionary *dict) {
+    return (mock_dictionary_data *) mock__get_ptr(dict);
+}
+
+static void mock__dictionary_unref(void *ptr) {
+    mock_dictionary_data *data = (mock_dictionary_data *) ptr;
+    if (mock__unref(data)) {
+        for (mock_dictionary_entry *entry = data->first, *next; entry; entry = next) {
+            next = entry->next;
+            mock_variant_destroy(&entry->key);
+            mock_variant_destroy(&entry->value);
+            mock__free(entry);
+        }
+        mock__free(data->buckets);
+        mock__free(data);
+    }
+}
+
+static mock_dictionary_entry *mock__dictionary_find(const mock_dictionary_data *data, const godot_variant *key, uint32_t hash) {
+    if (data->bucket_count == 0) {
+        return NULL;
+    }
+    mock_variant k = mock__variant_read(key);
+    for (mock_dictionary_entry *entry = data->buckets[hash & (data->bucket_count - 1)]; entry; entry = entry->bucket_next) {
+        if (entry->hash == hash) {
+            mock_variant entry_key = mock__variant_read(&entry->key);
+            if (mock__variant_hash_compare(&entry_key, &k)) {
+                return entry;
+            }
+        }
+    }
+    return NULL;
+}
+
+static uint32_t mock__dictionary_hash(const godot_variant *key) {
+    mock_variant k = mock__variant_read(key);
+    return mock__variant_hash(&k);
+}
+
+static mock_dictionary_entry *mock__dictionary_insert(mock_dictionary_data *data, const godot_variant *key, uint32_t hash) {
+    if ((uint32_t) data->size + 1 > data->bucket_count / 4 * 3) {
+        uint32_t bucket_count = data->bucket_count ? data->bucket_count * 2 : 8;
+        mock__free(data->buckets);
+        data->buckets = (mock_dictionary_entry **) mock__alloc(bucket_count * sizeof(mock_dictionary_entry *));
+        memset(data->buckets, 0, bucket_count * sizeof(mock_dictionary_entry *));
+        data->bucket_count = bucket_count;
+        for (mock_dictionary_entry *entry = data->first; entry; entry = entry->next) {
+            mock_dictionary_entry **bucket = &data->buckets[entry->hash & (bucket_count - 1)];
+            entry->bucket_next = *bucket;
+            *bucket = entry;
+        }
+    }
+    mock_dictionary_entry *entry = (mock_dictionary_entry *) mock__alloc(sizeof(mock_dictionary_entry));
+    mock_variant_new_copy(&entry->key, key);
+    mock_variant_new_nil(&entry->value);
+    entry->hash = hash;
+    entry->next = NULL;
+    entry->prev = data->last;
+    if (data->last) {
+        data->last->next = entry;
+    }
+    else {
+        data->first = entry;
+    }
+    data->last = entry;
+    mock_dictionary_entry **bucket = &data->buckets[hash & (data->bucket_count - 1)];
+    entry->bucket_next = *bucket;
+    *bucket = entry;
+    data->size++;
+    return entry;
+}
+
+static void mock_dictionary_new(godot_dictionary *r_dest) {
+    mock_dictionary_data *data = (mock_dictionary_data *) mock__ref_init(mock__alloc(sizeof(mock_dictionary_data)));
+    data->size = 0;
+    data->bucket_count = 0;
+    data->buckets = NULL;
+    data->first = data->last = NULL;
+    mock__set_ptr(r_dest, data);
+}
+
+static void mock_dictionary_new_copy(godot_dictionary *r_dest, const godot_dictionary *p_src) {
+    mock__set_ptr(r_dest, mock__ref(mock__dictionary_data(p_src)));
+}
+
+static godot_int mock_dictionary_size(const godot_dictionary *p_self) {
+    return mock__dictionary_data(p_self)->size;
+}
+
+static godot_bool mock_dictionary_has(const godot_dictionary *p_self, const godot_variant *p_key) {
+    return mock__dictionary_find(mock__dictionary_data(p_self), p_key, mock__dictionary_hash(p_key)) != NULL;
+}
+
+static godot_variant mock_dictionary_get(const godot_dictionary *p_self, const godot_variant *p_key) {
+    mock_dictionary_entry *entry = mock__dictionary_find(mock__dictionary_data(p_self), p_key, mock__dictionary_hash(p_key));
+    godot_variant value;
+    if (entry) {
+        mock_variant_new_copy(&value, &entry->value);
+    }
+    else {
+        mock_variant_new_nil(&value);
+    }
+    return value;
+}
+
+static godot_variant *mock_dictionary_operator_index(godot_dictionary *p_self, const godot_variant *p_key) {
+    mock_dictionary_data *data = mock__dictionary_data(p_self);
+    uint32_t hash = mock__dictionary_hash(p_key);
+    mock_dictionary_entry *entry = mock__dictionary_find(data, p_key, hash);
+    if (entry == NULL) {
+        entry = mock__dictionary_insert(data, p_key, hash);
+    }
+    return &entry->value;
+}
+
+static const godot_variant *mock_dictionary_operator_index_const(const godot_dictionary *p_self, const godot_variant *p_key) {
+    mock_dictionary_entry *entry = mock__dictionary_find(mock__dictionary_data(p_self), p_key, mock__dictionary_hash(p_key));
+    if (entry == NULL) {
+        // Godot crashes in this case
+        mock__fail(__func__, "key not found");
+    }
+    return &entry->value;
+}
+
+static void mock_dictionary_set(godot_dictionary *p_self, const godot_variant *p_key, const godot_variant *p_value) {
+    godot_variant copy;
+    mock_variant_new_copy(&copy, p_value);
+    godot_variant *value = mock_dictionary_operator_index(p_self, p_key);
+    mock_variant_destroy(value);
+    *value = copy;
+}
+
+static godot_variant *mock_dictionary_next(const godot_dictionary *p_self, const godot_variant *p_key) {
+    mock_dictionary_data *data = mock__dictionary_data(p_self);
+    mock_dictionary_entry *entry;
+    if (p_key == NULL) {
+        entry = data->first;
+    }
+    else {
+        entry = mock__dictionary_find(data, p_key, mock__dictionary_hash(p_key));
+        entry = entry ? entry->next : NULL;
+    }
+    return entry ? &entry->key : NULL;
+}
+
+static void mock_dictionary_destroy(godot_dictionary *p_self) {
+    mock__dictionary_unref(mock__dictionary_data(p_self));
+}
+
+static godot_dictionary mock_variant_as_dictionary(const godot_variant *p_self) {
+    mock_variant v = mock__variant_read(p_self);
+    godot_dictionary dict;
+    if (v.type == GODOT_VARIANT_TYPE_DICTIONARY) {
+        mock__set_ptr(&dict, mock__ref(v.as.ptr));
+    }
+    else {
+        mock_dictionary_new(&dict);
+    }
+    return dict;
+}
+
+// Pool*Arrays are copy-on-write, NULL data is an empty array. Elements are reallocated
+// to the exact size on every resize and accesses are allocated, like Godot's PoolVector.
+typedef struct mock_pool_data {
+    mock_ref ref;
+    godot_int size;
+    godot_bool strings;
+    uint8_t *data;
+} mock_pool_data;
+
+typedef struct mock_pool_access {
+    mock_pool_data *pool;
+} mock_pool_access;
+
+static mock_pool_data *mock__pool_data(const void *array) {
+    return (mock_pool_data *) mock__get_ptr(array);
+}
+
+static void mock__pool_unref(void *ptr) {
+    mock_pool_data *pool = (mock_pool_data *) ptr;
+    if (mock__unref(pool)) {
+        if (pool->strings) {
+            for (godot_int i = 0; i < pool->size; i++) {
+                mock_string_destroy(&((godot_string *) pool->data)[i]);
+            }
+        }
+        mock__free(pool->data);
+        mock__free(pool);
+    }
+}
+
+// Make sure the array's data is not shared before writing to it
+static mock_pool_data *mock__pool_make_unique(void *array, size_t element_size) {
+    mock_pool_data *pool = mock__pool_data(array);
+    if (mock__is_shared(pool)) {
+        mock_pool_data *copy = (mock_pool_data *) mock__ref_init(mock__alloc(sizeof(mock_pool_data)));
+        copy->size = pool->size;
+        copy->strings = pool->strings;
+        copy->data = (uint8_t *) mock__alloc(pool->size * element_size);
+        memcpy(copy->data, pool->data, pool->size * element_size);
+        if (copy->strings) {
+            for (godot_int i = 0; i < copy->size; i++) {
+                mock__ref(mock__string_data(&((godot_string *) copy->data)[i]));
+            }
+        }
+        mock__pool_unref(pool);
+        mock__set_ptr(array, copy);
+        pool = copy;
+    }
+    return pool;
+}
+
+static void mock__pool_resize(void *array, size_t element_size, godot_bool strings, godot_int size) {
+    if (size < 0) {
+        mock__fail(__func__, "negative size");
+    }
+    mock_pool_data *pool = mock__pool_make_unique(array, element_size);
+    if (size == 0) {
+        mock__pool_unref(pool);
+        mock__set_ptr(array, NULL);
+        return;
+    }
+    if (pool == NULL) {
+        pool = (mock_pool_data *) mock__ref_init(mock__alloc(sizeof(mock_pool_data)));
+        pool->size = 0;
+        pool->strings = strings;
+        pool->data = NULL;
+        mock__set_ptr(array, pool);
+    }
+    if (strings) {
+        for (godot_int i = size; i < pool->size; i++) {
+            mock_string_destroy(&((godot_string *) pool->data)[i]);
+        }
+    }
+    pool->data = (uint8_t *) mock__realloc(pool->data, size * element_size);
+    if (size > pool->size) {
+        // Zeroed memory is a valid empty String
+        memset(pool->data + pool->size * element_size, 0, (size - pool->size) * element_size);
+    }
+    pool->size = size;
+}
+
+static godot_int mock__pool_size(const void *array) {
+    mock_pool_data *pool = mock__pool_data(array);
+    return pool ? pool->size : 0;
+}
+
+static void *mock__pool_access_new(mock_pool_data *pool) {
+    mock_pool_access *access = (mock_pool_access *) mock__alloc(sizeof(mock_pool_access));
+    access->pool = (mock_pool_data *) mock__ref(pool);
+    return access;
+}
+
+static void *mock__pool_access_ptr(const void *access) {
+    mock_pool_data *pool = ((const mock_pool_access *) access)->pool;
+    return pool ? pool->data : NULL;
+}
+
+static void mock__pool_access_destroy(void *access) {
+    mock__pool_unref(((mock_pool_access *) access)->pool);
+    mock__free(access);
+}
+
+static void mock__pool_set(void *array, size_t element_size, godot_bool strings, godot_int index, const void *value) {
+    mock_pool_data *pool = mock__pool_make_unique(array, element_size);
+    MOCK_CHECK_INDEX(index, pool ? pool->size : 0);
+    if (strings) {
+        godot_string *str = &((godot_string *) pool->data)[index];
+        mock_string_destroy(str);
+        mock_string_new_copy(str, (const godot_string *) value);
+    }
+    else {
+        memcpy(pool->data + index * element_size, value, element_size);
+    }
+}
+
+static void mock__pool_get(const void *array, size_t element_size, godot_bool strings, godot_int index, void *r_value) {
+    mock_pool_data *pool = mock__pool_data(array);
+    MOCK_CHECK_INDEX(index, pool ? pool->size : 0);
+    if (strings) {
+        mock_string_new_copy((godot_string *) r_value, &((godot_string *) pool->data)[index]);
+    }
+    else {
+        memcpy(r_value, pool->data + index * element_size, element_size);
+    }
+}
+
+#define MOCK_VALUE_ARG(arg)  (&(arg))
+#define MOCK_POINTER_ARG(arg)  (arg)
+
+#define MOCK_POOL_ARRAY_API(kind, ctype, arg_type, ARG_ADDRESS, strings, variant_type) \
+    static void mock_pool_##kind##_array_new(godot_pool_##kind##_array *r_dest) { \
+        mock__set_ptr(r_dest, NULL); \
+    } \
+    static void mock_pool_##kind##_array_new_copy(godot_pool_##kind##_array *r_dest, const godot_pool_##kind##_array *p_src) { \
+        mock__set_ptr(r_dest, mock__ref(mock__pool_data(p_src))); \
+    } \
+    static void mock_pool_##kind##_array_set(godot_pool_##kind##_array *p_self, const godot_int p_idx, arg_type p_data) { \
+        mock__pool_set(p_self, sizeof(ctype), strings, p_idx, ARG_ADDRESS(p_data)); \
+    } \
+    static ctype mock_pool_##kind##_array_get(const godot_pool_##kind##_array *p_self, const godot_int p_idx) { \
+        ctype value; \
+        mock__pool_get(p_self, sizeof(ctype), strings, p_idx, &value); \
+        return value; \
+    } \
+    static void mock_pool_##kind##_array_resize(godot_pool_##kind##_array *p_self, const godot_int p_size) { \
+        mock__pool_resize(p_self, sizeof(ctype), strings, p_size); \
+    } \
+    static godot_int mock_pool_##kind##_array_size(const godot_pool_##kind##_array *p_self) { \
+        return mock__pool_size(p_self); \
+    } \
+    static godot_pool_##kind##_array_read_access *mock_pool_##kind##_array_read(const godot_pool_##kind##_array *p_self) { \
+        return (godot_pool_##kind##_array_read_access *) mock__pool_access_new(mock__pool_data(p_self)); \
+    } \
+    static godot_pool_##kind##_array_write_access *mock_pool_##kind##_array_write(godot_pool_##kind##_array *p_self) { \
+        return (godot_pool_##kind##_array_write_access *) mock__pool_access_new(mock__pool_make_unique(p_self, sizeof(ctype))); \
+    } \
+    static const ctype *mock_pool_##kind##_array_read_access_ptr(const godot_pool_##kind##_array_read_access *p_read) { \
+        return (const ctype *) mock__pool_access_ptr(p_read); \
+    } \
+    static ctype *mock_pool_##kind##_array_write_access_ptr(const godot_pool_##kind##_array_write_access *p_write) { \
+        return (ctype *) mock__pool_access_ptr(p_write); \
+    } \
+    static void mock_pool_##kind##_array_read_access_destroy(godot_pool_##kind##_array_read_access *p_read) { \
+        mock__pool_access_destroy(p_read); \
+    } \
+    static void mock_pool_##kind##_array_write_access_destroy(godot_pool_##kind##_array_write_access *p_write) { \
+        mock__pool_access_destroy(p_write); \
+    } \
+    static void mock_pool_##kind##_array_destroy(godot_pool_##kind##_array *p_self) { \
+        mock__pool_unref(mock__pool_data(p_self)); \
+    } \
+    static void mock_variant_new_pool_##kind##_array(godot_variant *r_dest, const godot_pool_##kind##_array *p_pa) { \
+        mock__variant_new_ref(r_dest, variant_type, p_pa); \
+    } \
+    static godot_pool_##kind##_array mock_variant_as_pool_##kind##_array(const godot_variant *p_self) { \
+        mock_variant v = mock__variant_read(p_self); \
+        godot_pool_##kind##_array array; \
+        mock__set_ptr(&array, v.type == variant_type ? mock__ref(v.as.ptr) : NULL); \
+        return array; \
+    }
+
+MOCK_POOL_ARRAY_API(byte, uint8_t, const uint8_t, MOCK_VALUE_ARG, 0, GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY)
+MOCK_POOL_ARRAY_API(int, godot_int, const godot_int, MOCK_VALUE_ARG, 0, GODOT_VARIANT_TYPE_POOL_INT_ARRAY)
+MOCK_POOL_ARRAY_API(real, godot_real, const godot_real, MOCK_VALUE_ARG, 0, GODOT_VARIANT_TYPE_POOL_REAL_ARRAY)
+MOCK_POOL_ARRAY_API(string, godot_string, const godot_string *, MOCK_POINTER_ARG, 1, GODOT_VARIANT_TYPE_POOL_STRING_ARRAY)
+MOCK_POOL_ARRAY_API(vector2, godot_vector2, const godot_vector2 *, MOCK_POINTER_ARG, 0, GODOT_VARIANT_TYPE_POOL_VECTOR2_ARRAY)
+MOCK_POOL_ARRAY_API(vector3, godot_vector3, const godot_vector3 *, MOCK_POINTER_ARG, 0, GODOT_VARIANT_TYPE_POOL_VECTOR3_ARRAY)
+MOCK_POOL_ARRAY_API(color, godot_color, const godot_color *, MOCK_POINTER_ARG, 0, GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY)
+
+// Objects and method binds
+typedef struct mock_node {
+    godot_vector2 position;
+} mock_node;
+
+typedef void (*mock_ptrcall_func)(mock_node *self, const void **args, void *ret);
+typedef godot_variant (*mock_call_func)(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error);
+
+typedef struct mock_method {
+    const char *classname;
+    const char *name;
+    int argc;
+    mock_ptrcall_func ptrcall;
+    mock_call_func call;
+} mock_method;
+
+static void mock__assign_variant(void *ret, godot_variant value) {
+    // Variant return values are assigned to an already constructed Variant
+    if (ret) {
+        mock_variant_destroy((godot_variant *) ret);
+        *(godot_variant *) ret = value;
+    }
+    else {
+        mock_variant_destroy(&value);
+    }
+}
+
+static godot_variant mock__nil(void) {
+    godot_variant nil;
+    mock_variant_new_nil(&nil);
+    return nil;
+}
+
+static godot_bool mock__check_int_arg(const godot_variant *arg, int index, godot_variant_call_error *error) {
+    godot_variant_type type = mock_variant_get_type(arg);
+    if (type != GODOT_VARIANT_TYPE_INT && type != GODOT_VARIANT_TYPE_REAL && type != GODOT_VARIANT_TYPE_BOOL) {
+        error->error = GODOT_CALL_ERROR_CALL_ERROR_INVALID_ARGUMENT;
+        error->argument = index;
+        error->expected = GODOT_VARIANT_TYPE_INT;
+        return 0;
+    }
+    return 1;
+}
+
+static void mock_node_add_ptrcall(mock_node *self, const void **args, void *ret) {
+    *(int64_t *) ret = *(const int64_t *) args[0] + *(const int64_t *) args[1];
+}
+
+static godot_variant mock_node_add_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    if (!mock__check_int_arg(args[0], 0, error) || !mock__check_int_arg(args[1], 1, error)) {
+        return mock__nil();
+    }
+    godot_variant result;
+    mock_variant_new_int(&result, mock_variant_as_int(args[0]) + mock_variant_as_int(args[1]));
+    return result;
+}
+
+static void mock_node_get_position_ptrcall(mock_node *self, const void **args, void *ret) {
+    *(godot_vector2 *) ret = self->position;
+}
+
+static godot_variant mock_node_get_position_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    godot_variant result;
+    mock_variant_new_vector2(&result, &self->position);
+    return result;
+}
+
+static void mock_node_set_position_ptrcall(mock_node *self, const void **args, void *ret) {
+    self->position = *(const godot_vector2 *) args[0];
+}
+
+static godot_variant mock_node_set_position_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    self->position = mock_variant_as_vector2(args[0]);
+    return mock__nil();
+}
+
+static godot_variant mock__node_get(mock_node *self, const godot_string *property) {
+    godot_variant result;
+    if (mock__string_equals_cstring(property, "position")) {
+        mock_variant_new_vector2(&result, &self->position);
+    }
+    else {
+        mock_variant_new_nil(&result);
+    }
+    return result;
+}
+
+static void mock__node_set(mock_node *self, const godot_string *property, const godot_variant *value) {
+    if (mock__string_equals_cstring(property, "position")) {
+        self->position = mock_variant_as_vector2(value);
+    }
+}
+
+static void mock_object_get_ptrcall(mock_node *self, const void **args, void *ret) {
+    mock__assign_variant(ret, mock__node_get(self, (const godot_string *) args[0]));
+}
+
+static godot_variant mock_object_get_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    godot_string property = mock_variant_as_string(args[0]);
+    godot_variant result = mock__node_get(self, &property);
+    mock_string_destroy(&property);
+    return result;
+}
+
+static void mock_object_set_ptrcall(mock_node *self, const void **args, void *ret) {
+    mock__node_set(self, (const godot_string *) args[0], (const godot_variant *) args[1]);
+}
+
+static godot_variant mock_object_set_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    godot_string property = mock_variant_as_string(args[0]);
+    mock__node_set(self, &property, args[1]);
+    mock_string_destroy(&property);
+    return mock__nil();
+}
+
+static godot_variant mock__object_call(mock_node *self, const godot_string *method, const godot_variant **args, int argc, godot_variant_call_error *error);
+
+static godot_variant mock_object_call_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    if (argc < 1) {
+        error->error = GODOT_CALL_ERROR_CALL_ERROR_TOO_FEW_ARGUMENTS;
+        error->argument = 1;
+        return mock__nil();
+    }
+    if (mock_variant_get_type(args[0]) != GODOT_VARIANT_TYPE_STRING) {
+        error->error = GODOT_CALL_ERROR_CALL_ERROR_INVALID_ARGUMENT;
+        error->argument = 0;
+        error->expected = GODOT_VARIANT_TYPE_STRING;
+        return mock__nil();
+    }
+    godot_string method = mock_variant_as_string(args[0]);
+    godot_variant result = mock__object_call(self, &method, args + 1, argc - 1, error);
+    mock_string_destroy(&method);
+    return result;
+}
+
+static godot_variant mock__object_callv(mock_node *self, const godot_string *method, const godot_array *args) {
+    // Like Godot's `Object::callv`, pass pointers to the Array's elements to `call`
+    mock_array_data *data = mock__array_data(args);
+    const godot_variant **argv = (const godot_variant **) (data->size ? mock__alloc(data->size * sizeof(godot_variant *)) : NULL);
+    for (godot_int i = 0; i < data->size; i++) {
+        argv[i] = &data->items[i];
+    }
+    godot_variant_call_error error = { GODOT_CALL_ERROR_CALL_OK };
+    godot_variant result = mock__object_call(self, method, argv, data->size, &error);
+    mock__free(argv);
+    return result;
+}
+
+static void mock_object_callv_ptrcall(mock_node *self, const void **args, void *ret) {
+    mock__assign_variant(ret, mock__object_callv(self, (const godot_string *) args[0], (const godot_array *) args[1]));
+}
+
+static godot_variant mock_object_callv_call(mock_node *self, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    godot_string method = mock_variant_as_string(args[0]);
+    godot_array array = mock_variant_as_array(args[1]);
+    godot_variant result = mock__object_callv(self, &method, &array);
+    mock_array_destroy(&array);
+    mock_string_destroy(&method);
+    return result;
+}
+
+static const mock_method mock__methods[] = {
+    { "Object", "call", -1, NULL, mock_object_call_call },
+    { "Object", "callv", 2, mock_object_callv_ptrcall, mock_object_callv_call },
+    { "Object", "get", 1, mock_object_get_ptrcall, mock_object_get_call },
+    { "Object", "set", 2, mock_object_set_ptrcall, mock_object_set_call },
+    { "MockNode", "add", 2, mock_node_add_ptrcall, mock_node_add_call },
+    { "MockNode", "get_position", 0, mock_node_get_position_ptrcall, mock_node_get_position_call },
+    { "MockNode", "set_position", 1, mock_node_set_position_ptrcall, mock_node_set_position_call },
+};
+#define MOCK_METHOD_COUNT ((int) (sizeof(mock__methods) / sizeof(mock__methods[0])))
+
+// Method names are looked up by hash first, like StringNames are
+static uint32_t mock__method_hashes[MOCK_METHOD_COUNT];
+
+static godot_variant mock__object_call(mock_node *self, const godot_string *method, const godot_variant **args, int argc, godot_variant_call_error *error) {
+    uint32_t hash = mock_string_hash(method);
+    for (int i = 0; i < MOCK_METHOD_COUNT; i++) {
+        const mock_method *m = &mock__methods[i];
+        if (mock__method_hashes[i] == hash && mock__string_equals_cstring(method, m->name)) {
+            if (m->argc >= 0 && argc != m->argc) {
+                error->error = argc < m->argc ? GODOT_CALL_ERROR_CALL_ERROR_TOO_FEW_ARGUMENTS : GODOT_CALL_ERROR_CALL_ERROR_TOO_MANY_ARGUMENTS;
+                error->argument = m->argc;
+                return mock__nil();
+            }
+            error->error = GODOT_CALL_ERROR_CALL_OK;
+            return m->call(self, args, argc, error);
+        }
+    }
+    error->error = GODOT_CALL_ERROR_CALL_ERROR_INVALID_METHOD;
+    return mock__nil();
+}
+
+static godot_method_bind *mock_method_bind_get_method(const char *p_classname, const char *p_methodname) {
+    for (int i = 0; i < MOCK_METHOD_COUNT; i++) {
+        const mock_method *m = &mock__methods[i];
+        if (strcmp(m->name, p_methodname) == 0
+            && (strcmp(m->classname, p_classname) == 0 || (strcmp(m->classname, "Object") == 0 && strcmp(p_classname, "MockNode") == 0))) {
+            return (godot_method_bind *) m;
+        }
+    }
+    return NULL;
+}
+
+static void mock_method_bind_ptrcall(godot_method_bind *p_method_bind, godot_object *p_instance, const void **p_args, void *p_ret) {
+    const mock_method *m = (const mock_method *) p_method_bind;
+    if (m->ptrcall == NULL) {
+        mock__fail(m->name, "ptrcall is not supported");
+    }
+    m->ptrcall((mock_node *) p_instance, p_args, p_ret);
+}
+
+static godot_variant mock_method_bind_call(godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error) {
+    const mock_method *m = (const mock_method *) p_method_bind;
+    p_call_error->error = GODOT_CALL_ERROR_CALL_OK;
+    if (p_instance == NULL) {
+        p_call_error->error = GODOT_CALL_ERROR_CALL_ERROR_INSTANCE_IS_NULL;
+        return mock__nil();
+    }
+    if (m->argc >= 0 && p_arg_count != m->argc) {
+        p_call_error->error = p_arg_count < m->argc ? GODOT_CALL_ERROR_CALL_ERROR_TOO_FEW_ARGUMENTS : GODOT_CALL_ERROR_CALL_ERROR_TOO_MANY_ARGUMENTS;
+        p_call_error->argument = m->argc;
+        return mock__nil();
+    }
+    return m->call((mock_node *) p_instance, p_args, p_arg_count, p_call_error);
+}
+
+godot_object *mock_api_new_node(void) {
+    mock_node *node = (mock_node *) mock__alloc(sizeof(mock_node));
+    memset(node, 0, sizeof(mock_node));
+    return (godot_object *) node;
+}
+
+void mock_api_free_node(godot_object *node) {
+    mock__free(node);
+}
+
+// Printing
+static _Thread_local char mock__last_print[16384];
+static _Thread_local int64_t mock__print_count;
+
+static void mock_print(const godot_string *p_message) {
+    // Godot converts messages to UTF-8 before writing them
+    godot_char_string utf8 = mock_string_utf8(p_message);
+    snprintf(mock__last_print, sizeof(mock__last_print), "%s", mock_char_string_get_data(&utf8));
+    mock_char_string_destroy(&utf8);
+    mock__print_count++;
+}
+
+static void mock_print_warning(const char *p_description, const char *p_function, const char *p_file, int p_line) {
+    snprintf(mock__last_print, sizeof(mock__last_print), "WARNING: %s: %s", p_function, p_description);
+    mock__print_count++;
+}
+
+static void mock_print_error(const char *p_description, const char *p_function, const char *p_file, int p_line) {
+    snprintf(mock__last_print, sizeof(mock__last_print), "ERROR: %s: %s", p_function, p_description);
+    mock__print_count++;
+}
+
+const char *mock_api_last_print(void) {
+    return mock__last_print;
+}
+
+int64_t mock_api_print_count(void) {
+    return mock__print_count;
+}
+
+// Memory
+static void *mock_alloc(int p_bytes) {
+    return mock__alloc(p_bytes);
+}
+
+static void *mock_realloc(void *p_ptr, int p_bytes) {
+    return mock__realloc(p_ptr, p_bytes);
+}
+
+static void mock_free(void *p_ptr) {
+    mock__free(p_ptr);
+}
+
+mock_alloc_stats mock_api_get_alloc_stats(void) {
+    return mock__alloc_stats;
+}
+
+// Initialization
+static godot_gdnative_core_api_struct mock__api;
+static godot_gdnative_init_options mock__init_options;
+static int mock__library;
+
+void mock_api_init(void) {
+    godot_gdnative_core_api_struct *api = &mock__api;
+    api->type = GDNATIVE_CORE;
+    api->version.major = 1;
+    api->version.minor = 0;
+#define MOCK_SET(name)  api->godot_##name = mock_##name;
+#define MOCK_SET_VARIANT(kind)  MOCK_SET(variant_new_##kind) MOCK_SET(variant_as_##kind)
+#define MOCK_SET_POOL_ARRAY(kind) \
+    MOCK_SET_VARIANT(pool_##kind##_array) \
+    MOCK_SET(pool_##kind##_array_new) MOCK_SET(pool_##kind##_array_new_copy) \
+    MOCK_SET(pool_##kind##_array_set) MOCK_SET(pool_##kind##_array_get) \
+    MOCK_SET(pool_##kind##_array_resize) MOCK_SET(pool_##kind##_array_size) \
+    MOCK_SET(pool_##kind##_array_read) MOCK_SET(pool_##kind##_array_write) \
+    MOCK_SET(pool_##kind##_array_read_access_ptr) MOCK_SET(pool_##kind##_array_write_access_ptr) \
+    MOCK_SET(pool_##kind##_array_read_access_destroy) MOCK_SET(pool_##kind##_array_write_access_destroy) \
+    MOCK_SET(pool_##kind##_array_destroy)
+    MOCK_SET(alloc) MOCK_SET(realloc) MOCK_SET(free)
+    MOCK_SET(print) MOCK_SET(print_warning) MOCK_SET(print_error)
+    MOCK_SET(method_bind_get_method) MOCK_SET(method_bind_ptrcall) MOCK_SET(method_bind_call)
+    MOCK_SET(string_new) MOCK_SET(string_new_copy) MOCK_SET(string_new_with_wide_string)
+    MOCK_SET(string_operator_index) MOCK_SET(string_operator_index_const)
+    MOCK_SET(string_wide_str) MOCK_SET(string_length) MOCK_SET(string_utf8)
+    MOCK_SET(string_chars_to_utf8) MOCK_SET(string_chars_to_utf8_with_len)
+    MOCK_SET(string_hash) MOCK_SET(string_operator_equal) MOCK_SET(string_destroy)
+    MOCK_SET(char_string_length) MOCK_SET(char_string_get_data) MOCK_SET(char_string_destroy)
+    MOCK_SET(string_name_new) MOCK_SET(string_name_new_data) MOCK_SET(string_name_get_name)
+    MOCK_SET(string_name_get_hash) MOCK_SET(string_name_get_data_unique_pointer) MOCK_SET(string_name_destroy)
+    MOCK_SET(node_path_new) MOCK_SET(node_path_as_string) MOCK_SET(node_path_destroy)
+    MOCK_SET(variant_get_type) MOCK_SET(variant_new_copy) MOCK_SET(variant_destroy)
+    MOCK_SET(variant_new_nil) MOCK_SET(variant_new_bool) MOCK_SET(variant_new_uint)
+    MOCK_SET(variant_new_int) MOCK_SET(variant_new_real) MOCK_SET(variant_new_object)
+    MOCK_SET(variant_as_bool) MOCK_SET(variant_as_uint) MOCK_SET(variant_as_int)
+    MOCK_SET(variant_as_real) MOCK_SET(variant_as_object)
+    MOCK_SET(variant_operator_equal) MOCK_SET(variant_hash_compare)
+    MOCK_SET_VARIANT(string) MOCK_SET_VARIANT(node_path) MOCK_SET_VARIANT(rid)
+    MOCK_SET_VARIANT(vector2) MOCK_SET_VARIANT(rect2) MOCK_SET_VARIANT(vector3)
+    MOCK_SET_VARIANT(transform2d) MOCK_SET_VARIANT(plane) MOCK_SET_VARIANT(quat)
+    MOCK_SET_VARIANT(aabb) MOCK_SET_VARIANT(basis) MOCK_SET_VARIANT(transform) MOCK_SET_VARIANT(color)
+    MOCK_SET_VARIANT(array) MOCK_SET_VARIANT(dictionary)
+    MOCK_SET(array_new) MOCK_SET(array_new_copy) MOCK_SET(array_set) MOCK_SET(array_get)
+    MOCK_SET(array_operator_index) MOCK_SET(array_operator_index_const) MOCK_SET(array_append)
+    MOCK_SET(array_clear) MOCK_SET(array_resize) MOCK_SET(array_size) MOCK_SET(array_destroy)
+    MOCK_SET(dictionary_new) MOCK_SET(dictionary_new_copy) MOCK_SET(dictionary_size) MOCK_SET(dictionary_has)
+    MOCK_SET(dictionary_get) MOCK_SET(dictionary_set) MOCK_SET(dictionary_operator_index)
+    MOCK_SET(dictionary_operator_index_const) MOCK_SET(dictionary_next) MOCK_SET(dictionary_destroy)
+    MOCK_SET_POOL_ARRAY(byte) MOCK_SET_POOL_ARRAY(int) MOCK_SET_POOL_ARRAY(real) MOCK_SET_POOL_ARRAY(string)
+    MOCK_SET_POOL_ARRAY(vector2) MOCK_SET_POOL_ARRAY(vector3) MOCK_SET_POOL_ARRAY(color)
+#undef MOCK_SET_POOL_ARRAY
+#undef MOCK_SET_VARIANT
+#undef MOCK_SET
+
+    for (int i = 0; i < MOCK_METHOD_COUNT; i++) {
+        godot_string name;
+        mock__string_init_cstring(&name, mock__methods[i].name);
+        mock__method_hashes[i] = mock_string_hash(&name);
+        mock_string_destroy(&name);
+    }
+
+    mock__init_options.gd_native_library = (godot_object *) &mock__library;
+    mock__init_options.api_struct = api;
+    hgdn_gdnative_init(&mock__init_options);
+}
+
+void mock_api_terminate(void) {
+    godot_gdnative_terminate_options options = { 0 };
+    hgdn_gdnative_terminate(&options);
+}
@@ -0,0 +1,39 @@
+// Plain C implementation of the parts of the GDNative core API used by HGDN, for benchmarking without Godot.
+//
+// Strings, Variants, Arrays, Dictionaries and Pool*Arrays mimic Godot 3's data layout and
+// allocation behaviour: Strings, Arrays, Dictionaries and Pool*Arrays are reference counted,
+// small math types live inside Variants while Transform2D, AABB, Basis and Transform are boxed,
+// Pool*Array read and write accesses are allocated, Strings and Pool*Arrays are copy-on-write
+// and Dictionaries allocate one node per entry. Every allocation, including the ones made
+// through `godot_alloc`, is counted per thread.
+//
+// Objects are instances of a single class, `MockNode`, with the methods
+// `add(int a, int b) -> int`, `get_position() -> Vector2` and `set_position(Vector2)`,
+// plus Object's `call`, `callv`, `get` and `set` for its `position` property.
+#ifndef HGDN_BENCH_MOCK_API_H
+#define HGDN_BENCH_MOCK_API_H
+
+#include "hgdn.h"
+
+typedef struct mock_alloc_stats {
+    int64_t allocs;  ///< Number of allocations and reallocations
+    int64_t bytes;  ///< Bytes requested by them
+} mock_alloc_stats;
+
+/// Fill the mock core API and pass it to `hgdn_gdnative_init` through fake init options
+void mock_api_init(void);
+/// Call `hgdn_gdnative_terminate`
+void mock_api_terminate(void);
+
+/// Allocations made by the calling thread since it started
+mock_alloc_stats mock_api_get_alloc_stats(void);
+
+godot_object *mock_api_new_node(void);
+void mock_api_free_node(godot_object *node);
+
+/// Message last printed by the calling thread with `godot_print`, `godot_print_warning` or `godot_print_error`, as UTF-8
+const char *mock_api_last_print(void);
+/// Number of messages printed by the calling thread
+int64_t mock_api_print_count(void);
+
+#endif  // HGDN_BENCH_MOCK_API_H
@@ -24,7 +24,47 @@
  * - HGDN_DECL:
  *   Function declaration prefix (default: `extern` or `static` depending on HGDN_STATIC)
  * - HGDN_STRING_FORMAT_BUFFER_SIZE:
- *   Size of the global char buffer used for `hgdn_print*` functions. Defaults to 1024
+ *   Size of the per-thread char buffer used for `hgdn_print*` and `hgdn_new_formatted_string` functions.
+ *   Longer messages are formatted into a heap allocated buffer instead. Defaults to 1024
+ * - HGDN_LOG_LEVEL:
+ *   Minimum level of messages printed by `HGDN_PRINT_*` macros, one of `HGDN_LOG_LEVEL_DEBUG`,
+ *   `HGDN_LOG_LEVEL_INFO`, `HGDN_LOG_LEVEL_WARNING`, `HGDN_LOG_LEVEL_ERROR` or `HGDN_LOG_LEVEL_NONE`.
+ *   Macros for lower levels compile to nothing, without evaluating their arguments. Defaults to `HGDN_LOG_LEVEL_DEBUG`
+ * - HGDN_LOG_RECORD_TEXT_SIZE:
+ *   Size of the text stored inline in each asynchronous log record, see `hgdn_log_async_start`.
+ *   Longer messages are copied to a heap allocated buffer. Defaults to 256
+ * - HGDN_OBJECT_CALL_STACK_ARGS_MAX:
+ *   Maximum number of arguments `hgdn_object_call*` functions pass using stack memory.
+ *   Calls with more arguments allocate the argument pointer array in the heap. Defaults to 16
+ * - HGDN_CACHE_LINE_SIZE:
+ *   Alignment of instance pool chunks, see `hgdn_instance_pool_new`. Must be a power of two. Defaults to 64
+ * - HGDN_INSTANCE_POOL_CHUNK_SIZE:
+ *   Number of instances allocated at a time by `hgdn_instance_create_func_pool`. Defaults to 64
+ * - HGDN_ARENA_BLOCK_SIZE:
+ *   Default minimum size in bytes of arena blocks, see `hgdn_arena`. Defaults to 65536
+ * - HGDN_MEMORY_STATS:
+ *   If defined, `hgdn_alloc*` functions keep per tag counters of live and peak bytes, number of allocations
+ *   and allocation sizes, available with `hgdn_memory_get_stats`. Each allocation gets a 16 byte header.
+ * - HGDN_MEMORY_USER_TAGS:
+ *   Number of memory tags available for applications, starting at `HGDN_MEMORY_TAG_USER`. Defaults to 8
+ * - HGDN_COUNT_API_CALLS:
+ *   If defined, `hgdn_gdnative_init` installs a proxy over `hgdn_core_api` that counts calls per entry,
+ *   see `hgdn_api_calls_get_top`
+ * - HGDN_PROFILE:
+ *   If defined, `hgdn_register_class` wraps methods and property accessors in timing shims, see `hgdn_profile_get_stats`
+ * - HGDN_PROFILE_MAX_ENTRIES:
+ *   Maximum number of profiled methods, property getters and setters. Further ones are not profiled. Defaults to 256
+ * - HGDN_PROFILE_TRACE_EVENTS:
+ *   Number of calls each thread keeps for `hgdn_profile_trace_json`. Must be a power of two. Defaults to 4096
+ * - HGDN_USE_UTF8_TRANSCODER:
+ *   If defined, `hgdn_new_string*` functions decode UTF-8 using HGDN's own transcoder and create Strings
+ *   with `godot_string_new_with_wide_string`, instead of using `godot_string_chars_to_utf8`.
+ *   ASCII runs are converted with SSE2/AVX2 when enabled in the compiler, e.g. with `-mavx2`.
+ *   `hgdn_string_get` also encodes the characters from `godot_string_wide_str` itself instead of using
+ *   `godot_string_utf8`, leaving `gd_char_string` empty.
+ *   The same transcoder is always used by `hgdn_string_get_utf8` and `hgdn_packed_string_array_get`
+ * - HGDN_NO_SIMD:
+ *   Disable SSE2/AVX2 code paths, using only portable C
  * - HGDN_NO_CORE_1_1:
  * - HGDN_NO_CORE_1_2:
  * - HGDN_NO_CORE_1_3:
@@ -39,7 +79,12 @@
 #ifndef __HGDN_H__
 #define __HGDN_H__
 
+#include <stddef.h>
 #include <stdint.h>
+#if defined(__cplusplus) && __cplusplus >= 201103L
+    #include <initializer_list>
+    #include <type_traits>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,6 +103,19 @@ extern "C" {
     #define HGDN_STRING_FORMAT_BUFFER_SIZE 1024
 #endif
 
+#define HGDN_LOG_LEVEL_DEBUG 0
+#define HGDN_LOG_LEVEL_INFO 1
+#define HGDN_LOG_LEVEL_WARNING 2
+#define HGDN_LOG_LEVEL_ERROR 3
+#define HGDN_LOG_LEVEL_NONE 4
+#ifndef HGDN_LOG_LEVEL
+    #define HGDN_LOG_LEVEL HGDN_LOG_LEVEL_DEBUG
+#endif
+
+#ifndef HGDN_LOG_RECORD_TEXT_SIZE
+    #define HGDN_LOG_RECORD_TEXT_SIZE 256
+#endif
+
 #if defined(__cplusplus) && __cplusplus >= 201103L  // `constexpr` is a C++11 feature
     #define HGDN_CONSTEXPR constexpr
 #else
@@ -68,6 +126,34 @@ extern "C" {
     #define HGDN_METHOD_ARGUMENTS_INFO_MAX 16
 #endif
 
+#ifndef HGDN_OBJECT_CALL_STACK_ARGS_MAX
+    #define HGDN_OBJECT_CALL_STACK_ARGS_MAX 16
+#endif
+
+#ifndef HGDN_CACHE_LINE_SIZE
+    #define HGDN_CACHE_LINE_SIZE 64
+#endif
+
+#ifndef HGDN_INSTANCE_POOL_CHUNK_SIZE
+    #define HGDN_INSTANCE_POOL_CHUNK_SIZE 64
+#endif
+
+#ifndef HGDN_ARENA_BLOCK_SIZE
+    #define HGDN_ARENA_BLOCK_SIZE 65536
+#endif
+
+#ifndef HGDN_MEMORY_USER_TAGS
+    #define HGDN_MEMORY_USER_TAGS 8
+#endif
+
+#ifndef HGDN_PROFILE_MAX_ENTRIES
+    #define HGDN_PROFILE_MAX_ENTRIES 256
+#endif
+
+#ifndef HGDN_PROFILE_TRACE_EVENTS
+    #define HGDN_PROFILE_TRACE_EVENTS 4096
+#endif
+
 // Macro magic to get the number of variable arguments
 // Ref: https://groups.google.com/g/comp.std.c/c/d-6Mj5Lko_s
 #define HGDN__NARG(...)  HGDN__NARG_(__VA_ARGS__, HGDN__NARG_RSEQ_N())
@@ -94,6 +180,8 @@ extern "C" {
 #define HGDN__MAP1(f, x, peek, ...)  f(x)  HGDN__MAP_NEXT(peek, HGDN__MAP0)(f, peek, __VA_ARGS__)
 #define HGDN__MAP(f, ...)  HGDN__EVAL(HGDN__MAP1(f, __VA_ARGS__, (), 0))
 
+// Literal array followed by its size, for initializers that contain commas (e.g.: structs)
+#define HGDN__ARRAY_LITERAL_ARGS(type, ...)  ((type[]){ __VA_ARGS__ }), ((godot_int) (sizeof((type[]){ __VA_ARGS__ }) / sizeof(type)))
 
 
 /// @defgroup custom_math_types Custom math types
@@ -317,6 +405,9 @@ extern const godot_gdnative_ext_net_3_2_api_struct *hgdn_net_3_2_api;
 #endif
 extern godot_object *hgdn_library;  ///< GDNativeLibrary object being initialized
 extern godot_method_bind *hgdn_method_Object_callv;
+extern godot_method_bind *hgdn_method_Object_call;
+extern godot_method_bind *hgdn_method_Object_get;
+extern godot_method_bind *hgdn_method_Object_set;
 /// @}
 
 
@@ -328,29 +419,208 @@ HGDN_DECL void hgdn_gdnative_terminate(const godot_gdnative_terminate_options *o
 /// @}
 
 
+/// @defgroup api_calls Core API call counting
+/// Number of calls made to each `hgdn_core_api` entry, for finding code that calls into the engine too often
+///
+/// If `HGDN_COUNT_API_CALLS` is defined, `hgdn_gdnative_init` replaces `hgdn_core_api` with a proxy
+/// that counts calls and forwards them to Godot. Every call made through `hgdn_core_api` is counted,
+/// including the ones made by your own code. Entries not used by HGDN itself are forwarded without
+/// being counted. Otherwise, no proxy is installed and functions report nothing.
+/// @{
+typedef struct hgdn_api_call_count {
+    const char *name;  ///< Name of the core API entry, like `"godot_variant_destroy"`
+    int64_t calls;
+} hgdn_api_call_count;
+
+/// Total number of counted calls
+HGDN_DECL int64_t hgdn_api_calls_get_total();
+/// Fill `buffer` with at most `size` most called entries, in descending order, returning how many were filled
+HGDN_DECL godot_int hgdn_api_calls_get_top(hgdn_api_call_count *buffer, const godot_int size);
+/// Reset all counters to zero, for example before running the code to be measured
+HGDN_DECL void hgdn_api_calls_reset();
+/// Print the total and the `count` most called entries
+HGDN_DECL void hgdn_api_calls_print_report(const godot_int count);
+/// Create a Dictionary with entry names as keys and number of calls as values, only for entries that were called
+HGDN_DECL godot_dictionary hgdn_api_calls_to_dictionary();
+/// @}
+
+
 /// @defgroup memory Memory related functions
 /// `stdlib.h` compatible functions that track memory usage when Godot is running in debug mode
+///
+/// If `HGDN_MEMORY_STATS` is defined, allocations are also accounted per tag.
+/// In this mode memory allocated by `hgdn_alloc*` functions must only be
+/// freed by `hgdn_free`, and vice versa.
 /// @{
 HGDN_DECL void *hgdn_alloc(size_t size);  ///< Compatible with `malloc`
 HGDN_DECL void *hgdn_realloc(void *ptr, size_t size);  ///< Compatible with `realloc`
 /// Compatible with `free`. It is safe to pass NULL without triggering an error message.
 HGDN_DECL void hgdn_free(void *ptr);
+
+/// Allocation tags for memory statistics, see `HGDN_MEMORY_STATS`
+typedef enum hgdn_memory_tag {
+    HGDN_MEMORY_TAG_DEFAULT,  ///< `hgdn_alloc` and HGDN allocations without a specific tag
+    HGDN_MEMORY_TAG_STRING,  ///< String conversions, string arrays and string builders
+    HGDN_MEMORY_TAG_ARENA,  ///< Arena blocks
+    HGDN_MEMORY_TAG_INSTANCE,  ///< NativeScript instance data and instance pools
+    HGDN_MEMORY_TAG_LOG,  ///< Asynchronous logging
+    HGDN_MEMORY_TAG_CACHE,  ///< Interned strings, struct schemas and method bind cache
+    HGDN_MEMORY_TAG_USER,  ///< First tag available for applications, up to `HGDN_MEMORY_TAG_COUNT - 1`
+    HGDN_MEMORY_TAG_COUNT = HGDN_MEMORY_TAG_USER + HGDN_MEMORY_USER_TAGS,
+} hgdn_memory_tag;
+
+/// Number of allocation size classes: up to 16 bytes, up to 32 bytes, ... and bigger than 256 KiB
+#define HGDN_MEMORY_SIZE_CLASSES 16
+
+typedef struct hgdn_memory_tag_stats {
+    int64_t live_bytes;  ///< Bytes currently allocated
+    int64_t peak_bytes;  ///< Maximum value of `live_bytes`
+    int64_t allocations;  ///< Number of allocations, reallocations included
+    int64_t frees;  ///< Number of frees, reallocations included
+    int64_t allocated_bytes;  ///< Total bytes allocated
+    int64_t size_classes[HGDN_MEMORY_SIZE_CLASSES];  ///< Number of allocations per size class
+} hgdn_memory_tag_stats;
+
+typedef struct hgdn_memory_stats {
+    hgdn_memory_tag_stats tags[HGDN_MEMORY_TAG_COUNT];
+} hgdn_memory_stats;
+
+/// Like `hgdn_alloc`, accounting memory to `tag`
+HGDN_DECL void *hgdn_alloc_tagged(size_t size, hgdn_memory_tag tag);
+/// Like `hgdn_realloc`, accounting memory to `tag`
+HGDN_DECL void *hgdn_realloc_tagged(void *ptr, size_t size, hgdn_memory_tag tag);
+
+/// Get memory statistics, all zeros unless `HGDN_MEMORY_STATS` is defined
+HGDN_DECL hgdn_memory_stats hgdn_memory_get_stats();
+/// Name of `tag`, like `"string"` or `"user0"`
+HGDN_DECL const char *hgdn_memory_tag_name(hgdn_memory_tag tag);
+/// Create a Dictionary with tag names as keys and Dictionaries with each tag's statistics as values
+HGDN_DECL godot_dictionary hgdn_memory_stats_to_dictionary(const hgdn_memory_stats *stats);
+/// Native call that returns the memory statistics Dictionary, to be called with `call_native("standard_varcall", ...)`
+HGDN_DECL godot_variant hgdn_memory_stats_native_call(godot_array *args);
+/// NativeScript method that returns the memory statistics Dictionary
+HGDN_DECL godot_variant hgdn_memory_stats_method(godot_object *instance, void *method_data, void *data, int argc, godot_variant **args);
+/// @}
+
+
+/// @defgroup arena Arena allocator
+/// Bump allocator for short-lived buffers, released all at once
+///
+/// Allocations are carved sequentially from blocks allocated with `hgdn_alloc`
+/// and are never freed individually: reset the arena or roll it back to a
+/// previously taken mark instead. Blocks are kept for reuse until the arena is
+/// destroyed, so an arena that is reset regularly stops allocating once it
+/// reaches its working size. Arenas are not thread-safe.
+///
+/// Each thread has a scratch arena available through `hgdn_scratch_arena`.
+/// Call `hgdn_frame_arena_reset` once per frame in the main thread to release
+/// all of that frame's temporaries. The calling thread's scratch arena is
+/// destroyed by `hgdn_gdnative_terminate`, other threads should destroy theirs
+/// before exiting.
+/// @{
+typedef struct hgdn_arena_block hgdn_arena_block;
+
+typedef struct hgdn_arena {
+    hgdn_arena_block *first;
+    hgdn_arena_block *current;
+    /// Minimum size of new blocks. If 0, `HGDN_ARENA_BLOCK_SIZE` is used.
+    size_t block_size;
+} hgdn_arena;
+
+/// Arena position to roll back to with `hgdn_arena_reset_to_mark`
+typedef struct hgdn_arena_mark {
+    hgdn_arena_block *block;
+    size_t used;
+} hgdn_arena_mark;
+
+HGDN_DECL hgdn_arena hgdn_new_arena(size_t block_size);
+/// Allocate `size` bytes aligned to 16 bytes, returning NULL if a new block couldn't be allocated
+HGDN_DECL void *hgdn_arena_alloc(hgdn_arena *arena, size_t size);
+/// Allocate zero-initialized memory for `count` elements of `size` bytes
+HGDN_DECL void *hgdn_arena_calloc(hgdn_arena *arena, size_t count, size_t size);
+HGDN_DECL hgdn_arena_mark hgdn_arena_get_mark(const hgdn_arena *arena);
+/// Release everything allocated after `mark` was taken
+HGDN_DECL void hgdn_arena_reset_to_mark(hgdn_arena *arena, hgdn_arena_mark mark);
+/// Release all allocations, keeping blocks for reuse
+HGDN_DECL void hgdn_arena_reset(hgdn_arena *arena);
+/// Free all blocks. The arena may be used again afterwards.
+HGDN_DECL void hgdn_arena_destroy(hgdn_arena *arena);
+
+/// Get the calling thread's scratch arena
+HGDN_DECL hgdn_arena *hgdn_scratch_arena();
+/// Reset the calling thread's scratch arena
+HGDN_DECL void hgdn_frame_arena_reset();
 /// @}
 
 
 /// @defgroup print Printing functions
 /// Functions that print a `printf` formatted message to Godot's output
+///
+/// `hgdn_print*` functions always print. The `HGDN_PRINT_*` macros discard messages
+/// below the current log level before formatting them, `HGDN_PRINT_DEBUG` and
+/// `HGDN_PRINT_INFO` printing with `hgdn_print`.
 /// @{
 HGDN_DECL void hgdn_print(const char *fmt, ...);
 HGDN_DECL void hgdn_print_warning(const char *funcname, const char *filename, int line, const char *fmt, ...);
 HGDN_DECL void hgdn_print_error(const char *funcname, const char *filename, int line, const char *fmt, ...);
+
+/// Runtime log level, never lower than `HGDN_LOG_LEVEL`. Change it using `hgdn_log_set_level`.
+/// May be changed while other threads print, so it is only accessed atomically.
+extern int hgdn_log_level;
+/// Set runtime log level. Levels lower than the compile-time `HGDN_LOG_LEVEL` are clamped to it.
+HGDN_DECL void hgdn_log_set_level(int level);
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define hgdn__atomic_load_int_relaxed(p)  (*(const volatile int *) (p))
+#else
+    #define hgdn__atomic_load_int_relaxed(p)  __atomic_load_n((p), __ATOMIC_RELAXED)
+#endif
+#define hgdn_log_enabled(level)  ((level) >= HGDN_LOG_LEVEL && (level) >= hgdn__atomic_load_int_relaxed(&hgdn_log_level))
+
 #ifdef _MSC_VER
-#define HGDN_PRINT_WARNING(fmt, ...)  (hgdn_print_warning(__FUNCTION__, __FILE__, __LINE__, fmt, ##__VA_ARGS__))
-#define HGDN_PRINT_ERROR(fmt, ...)  (hgdn_print_error(__FUNCTION__, __FILE__, __LINE__, fmt, ##__VA_ARGS__))
+    #define HGDN__FUNCTION __FUNCTION__
+#else
+    #define HGDN__FUNCTION __PRETTY_FUNCTION__
+#endif
+#if HGDN_LOG_LEVEL <= HGDN_LOG_LEVEL_DEBUG
+    #define HGDN_PRINT_DEBUG(fmt, ...)  (hgdn_log_enabled(HGDN_LOG_LEVEL_DEBUG) ? hgdn_print(fmt, ##__VA_ARGS__) : (void) 0)
+#else
+    #define HGDN_PRINT_DEBUG(fmt, ...)  ((void) 0)
+#endif
+#if HGDN_LOG_LEVEL <= HGDN_LOG_LEVEL_INFO
+    #define HGDN_PRINT_INFO(fmt, ...)  (hgdn_log_enabled(HGDN_LOG_LEVEL_INFO) ? hgdn_print(fmt, ##__VA_ARGS__) : (void) 0)
+#else
+    #define HGDN_PRINT_INFO(fmt, ...)  ((void) 0)
+#endif
+#if HGDN_LOG_LEVEL <= HGDN_LOG_LEVEL_WARNING
+    #define HGDN_PRINT_WARNING(fmt, ...)  (hgdn_log_enabled(HGDN_LOG_LEVEL_WARNING) ? hgdn_print_warning(HGDN__FUNCTION, __FILE__, __LINE__, fmt, ##__VA_ARGS__) : (void) 0)
+#else
+    #define HGDN_PRINT_WARNING(fmt, ...)  ((void) 0)
+#endif
+#if HGDN_LOG_LEVEL <= HGDN_LOG_LEVEL_ERROR
+    #define HGDN_PRINT_ERROR(fmt, ...)  (hgdn_log_enabled(HGDN_LOG_LEVEL_ERROR) ? hgdn_print_error(HGDN__FUNCTION, __FILE__, __LINE__, fmt, ##__VA_ARGS__) : (void) 0)
 #else
-#define HGDN_PRINT_WARNING(fmt, ...)  (hgdn_print_warning(__PRETTY_FUNCTION__, __FILE__, __LINE__, fmt, ##__VA_ARGS__))
-#define HGDN_PRINT_ERROR(fmt, ...)  (hgdn_print_error(__PRETTY_FUNCTION__, __FILE__, __LINE__, fmt, ##__VA_ARGS__))
+    #define HGDN_PRINT_ERROR(fmt, ...)  ((void) 0)
 #endif
+
+/// Asynchronous logging counters
+typedef struct hgdn_log_stats {
+    int64_t enqueued;  ///< Messages queued by `hgdn_print*`
+    int64_t flushed;  ///< Messages forwarded to Godot by `hgdn_log_flush`
+    int64_t dropped;  ///< Messages discarded because the queue was full
+} hgdn_log_stats;
+/// Make `hgdn_print*` queue messages instead of printing them, so they can be called from any thread without stalls.
+/// Queued messages are printed by `hgdn_log_flush`. `capacity` is rounded up to a power of two.
+/// @note `funcname` and `filename` passed to `hgdn_print_warning` and `hgdn_print_error` must be
+///       static strings, like the ones used by `HGDN_PRINT_WARNING` and `HGDN_PRINT_ERROR`.
+HGDN_DECL godot_bool hgdn_log_async_start(godot_int capacity);
+/// Flush remaining messages and go back to printing synchronously.
+/// Safe while other threads are printing: it waits for messages being queued to be published,
+/// so none are lost, and later messages are printed synchronously.
+HGDN_DECL void hgdn_log_async_stop();
+/// Forward queued messages to Godot, returning how many were printed.
+/// Must be called from a single thread, usually the main thread once per frame.
+HGDN_DECL godot_int hgdn_log_flush();
+HGDN_DECL hgdn_log_stats hgdn_log_get_stats();
 /// @}
 
 /// @defgroup assert Runtime assertions
@@ -367,6 +637,12 @@ HGDN_DECL void hgdn_print_error(const char *funcname, const char *filename, int
 #define HGDN_ASSERT_ARRAY_SIZE(arr, min_size)  HGDN_ASSERT_MSG(hgdn_core_api->godot_array_size((arr)) >= (min_size), "Error: array should have size of at least " #min_size ", got %d", hgdn_core_api->godot_array_size((arr)))
 /// If `argc` isn't at least `min_size`, print error message and return nil Variant
 #define HGDN_ASSERT_ARGS_SIZE(argc, min_size)  HGDN_ASSERT_MSG((argc) >= (min_size), "Error: expected at least " #min_size " arguments, got %d", argc)
+/// Unpack `args` with `signature`, printing the error message and returning nil Variant on failure
+/// @see hgdn_args_unpack
+#define HGDN_ASSERT_ARGS_UNPACK(args, argc, signature, ...)  { const char *hgdn__unpack_error = hgdn_args_unpack((args), (argc), (signature), ##__VA_ARGS__); HGDN_ASSERT_MSG(hgdn__unpack_error == NULL, "%s", hgdn__unpack_error); }
+/// Unpack `arr` with `signature`, printing the error message and returning nil Variant on failure
+/// @see hgdn_array_unpack
+#define HGDN_ASSERT_ARRAY_UNPACK(arr, signature, ...)  { const char *hgdn__unpack_error = hgdn_array_unpack((arr), (signature), ##__VA_ARGS__); HGDN_ASSERT_MSG(hgdn__unpack_error == NULL, "%s", hgdn__unpack_error); }
 /// @}
 
 /// @defgroup string_wrapper String wrapper
@@ -377,6 +653,7 @@ typedef struct hgdn_string {
     const char *ptr;
     godot_int length;
 } hgdn_string;
+/// With `HGDN_USE_UTF8_TRANSCODER`, `ptr` is allocated by HGDN and `gd_char_string` is left empty.
 HGDN_DECL hgdn_string hgdn_string_get(const godot_string *str);
 HGDN_DECL hgdn_string hgdn_string_get_own(godot_string str);
 HGDN_DECL void hgdn_string_destroy(hgdn_string *str);
@@ -386,9 +663,32 @@ typedef struct hgdn_wide_string {
     const wchar_t *ptr;
     godot_int length;
 } hgdn_wide_string;
+/// Takes its own reference to `str`, which must be destroyed with `hgdn_wide_string_destroy`.
+/// Strings are copy-on-write, so characters are shared instead of copied, but the reference
+/// counting still happens: prefer `hgdn_string_view_get` when `str` outlives the use.
 HGDN_DECL hgdn_wide_string hgdn_wide_string_get(const godot_string *str);
 HGDN_DECL hgdn_wide_string hgdn_wide_string_get_own(godot_string str);
 HGDN_DECL void hgdn_wide_string_destroy(hgdn_wide_string *str);
+
+/// Borrowed view of a String's characters, without copies or allocations.
+/// Valid while the String is alive and unmodified, there is nothing to destroy.
+typedef struct hgdn_string_view {
+    const wchar_t *ptr;
+    godot_int length;
+} hgdn_string_view;
+HGDN_DECL hgdn_string_view hgdn_string_view_get(const godot_string *str);
+
+/// UTF-8 string stored in a caller provided buffer, usually on the stack, falling back to the heap if it doesn't fit.
+/// `ptr` is always NULL terminated.
+typedef struct hgdn_utf8_string {
+    const char *ptr;
+    godot_int length;
+    char *heap_ptr;  ///< Heap buffer, NULL if string fit in the caller provided buffer
+} hgdn_utf8_string;
+HGDN_DECL hgdn_utf8_string hgdn_string_view_utf8(hgdn_string_view view, char *buffer, size_t buffer_size);
+HGDN_DECL hgdn_utf8_string hgdn_string_get_utf8(const godot_string *str, char *buffer, size_t buffer_size);
+/// Only frees memory if the string didn't fit the caller provided buffer
+HGDN_DECL void hgdn_utf8_string_destroy(hgdn_utf8_string *str);
 /// @}
 
 
@@ -457,6 +757,118 @@ typedef struct hgdn_string_array {
 HGDN_DECL hgdn_string_array hgdn_string_array_get(const godot_pool_string_array *array);
 HGDN_DECL hgdn_string_array hgdn_string_array_get_own(godot_pool_string_array array);
 HGDN_DECL void hgdn_string_array_destroy(hgdn_string_array *array);
+
+/// Packed alternative to `hgdn_string_array` that converts all strings to UTF-8 in a single allocation.
+/// Strings are stored NULL terminated and back to back in `data`, with
+/// byte `offsets` and `lengths` for each element.
+typedef struct hgdn_packed_string_array {
+    const char **ptr;
+    const godot_int *offsets;
+    const godot_int *lengths;
+    const char *data;
+    godot_int size;
+} hgdn_packed_string_array;
+HGDN_DECL hgdn_packed_string_array hgdn_packed_string_array_get(const godot_pool_string_array *array);
+HGDN_DECL hgdn_packed_string_array hgdn_packed_string_array_get_own(godot_pool_string_array array);
+/// Allocate the packed array from `arena`. It must not be destroyed, resetting the arena releases it.
+HGDN_DECL hgdn_packed_string_array hgdn_packed_string_array_get_arena(const godot_pool_string_array *array, hgdn_arena *arena);
+HGDN_DECL void hgdn_packed_string_array_destroy(hgdn_packed_string_array *array);
+/// @}
+
+
+/// @defgroup pool_array_write_wrapper Pool*Array write wrapper
+/// Wrapper around Pool*Array types with mutable pointer and array size
+///
+/// Use these for filling Pool*Arrays in place, for example ones created by
+/// `hgdn_new_*_array_uninit`, without staging data in a separate buffer.
+/// The Pool*Array must not be resized while a write wrapper is alive.
+/// @{
+typedef struct hgdn_byte_array_write {
+    godot_pool_byte_array_write_access *gd_write_access;
+    uint8_t *ptr;
+    godot_int size;
+} hgdn_byte_array_write;
+HGDN_DECL hgdn_byte_array_write hgdn_byte_array_write_get(godot_pool_byte_array *array);
+HGDN_DECL void hgdn_byte_array_write_destroy(hgdn_byte_array_write *array);
+
+typedef struct hgdn_int_array_write {
+    godot_pool_int_array_write_access *gd_write_access;
+    godot_int *ptr;
+    godot_int size;
+} hgdn_int_array_write;
+HGDN_DECL hgdn_int_array_write hgdn_int_array_write_get(godot_pool_int_array *array);
+HGDN_DECL void hgdn_int_array_write_destroy(hgdn_int_array_write *array);
+
+typedef struct hgdn_real_array_write {
+    godot_pool_real_array_write_access *gd_write_access;
+    godot_real *ptr;
+    godot_int size;
+} hgdn_real_array_write;
+HGDN_DECL hgdn_real_array_write hgdn_real_array_write_get(godot_pool_real_array *array);
+HGDN_DECL void hgdn_real_array_write_destroy(hgdn_real_array_write *array);
+
+typedef struct hgdn_vector2_array_write {
+    godot_pool_vector2_array_write_access *gd_write_access;
+    godot_vector2 *ptr;
+    godot_int size;
+} hgdn_vector2_array_write;
+HGDN_DECL hgdn_vector2_array_write hgdn_vector2_array_write_get(godot_pool_vector2_array *array);
+HGDN_DECL void hgdn_vector2_array_write_destroy(hgdn_vector2_array_write *array);
+
+typedef struct hgdn_vector3_array_write {
+    godot_pool_vector3_array_write_access *gd_write_access;
+    godot_vector3 *ptr;
+    godot_int size;
+} hgdn_vector3_array_write;
+HGDN_DECL hgdn_vector3_array_write hgdn_vector3_array_write_get(godot_pool_vector3_array *array);
+HGDN_DECL void hgdn_vector3_array_write_destroy(hgdn_vector3_array_write *array);
+
+typedef struct hgdn_color_array_write {
+    godot_pool_color_array_write_access *gd_write_access;
+    godot_color *ptr;
+    godot_int size;
+} hgdn_color_array_write;
+HGDN_DECL hgdn_color_array_write hgdn_color_array_write_get(godot_pool_color_array *array);
+HGDN_DECL void hgdn_color_array_write_destroy(hgdn_color_array_write *array);
+
+typedef struct hgdn_string_array_write {
+    godot_pool_string_array_write_access *gd_write_access;
+    godot_string *ptr;
+    godot_int size;
+} hgdn_string_array_write;
+HGDN_DECL hgdn_string_array_write hgdn_string_array_write_get(godot_pool_string_array *array);
+HGDN_DECL void hgdn_string_array_write_destroy(hgdn_string_array_write *array);
+/// @}
+
+
+/// @defgroup intern Interned strings
+/// Strings created once per distinct C string and kept alive until `hgdn_gdnative_terminate`
+///
+/// Useful for method, property and signal names that are passed to Godot
+/// over and over, avoiding UTF-8 decoding and String allocation on each use.
+/// Object helpers intern method and property names automatically.
+/// @{
+typedef struct hgdn_interned_string {
+    godot_string string;
+    godot_string_name string_name;
+    /// String Variant, ready to be passed as method argument or Dictionary key
+    godot_variant variant;
+    /// Internal copy of the C string used as key
+    const char *ptr;
+    godot_int length;
+} hgdn_interned_string;
+/// Get the interned strings for `cstr`, creating them on first use. Safe to call from any thread.
+/// The returned pointer is valid until `hgdn_gdnative_terminate` is called.
+/// Returns NULL if memory allocation fails.
+HGDN_DECL const hgdn_interned_string *hgdn_intern_string(const char *cstr);
+
+/// Handle to a persistent String Variant to be used as Dictionary key.
+/// Keys are interned strings, so they live until `hgdn_gdnative_terminate` and must not be destroyed.
+/// A NULL key, returned when interning fails, is accepted by functions taking keys:
+/// getters return the value converted from nil and builders skip its entry.
+typedef const hgdn_interned_string *hgdn_key;
+/// Get the key handle for `cstr`, creating it on first use. Same as `hgdn_intern_string`.
+HGDN_DECL hgdn_key hgdn_intern_key(const char *cstr);
 /// @}
 
 
@@ -486,6 +898,9 @@ HGDN_DECL godot_dictionary hgdn_variant_get_dictionary(const godot_variant *var)
 HGDN_DECL godot_array hgdn_variant_get_array(const godot_variant *var);
 
 HGDN_DECL hgdn_string hgdn_variant_get_string(const godot_variant *var);
+/// Get UTF-8 string using `buffer` as storage when it fits, avoiding heap allocations for short strings.
+/// @see hgdn_utf8_string
+HGDN_DECL hgdn_utf8_string hgdn_variant_get_string_utf8(const godot_variant *var, char *buffer, size_t buffer_size);
 HGDN_DECL hgdn_wide_string hgdn_variant_get_wide_string(const godot_variant *var);
 HGDN_DECL hgdn_byte_array hgdn_variant_get_byte_array(const godot_variant *var);
 HGDN_DECL hgdn_int_array hgdn_variant_get_int_array(const godot_variant *var);
@@ -551,6 +966,8 @@ HGDN_DECL godot_dictionary hgdn_array_get_dictionary(const godot_array *array, c
 HGDN_DECL godot_array hgdn_array_get_array(const godot_array *array, const godot_int index);
 
 HGDN_DECL hgdn_string hgdn_array_get_string(const godot_array *array, const godot_int index);
+/// @see hgdn_variant_get_string_utf8
+HGDN_DECL hgdn_utf8_string hgdn_array_get_string_utf8(const godot_array *array, const godot_int index, char *buffer, size_t buffer_size);
 HGDN_DECL hgdn_wide_string hgdn_array_get_wide_string(const godot_array *array, const godot_int index);
 HGDN_DECL hgdn_byte_array hgdn_array_get_byte_array(const godot_array *array, const godot_int index);
 HGDN_DECL hgdn_int_array hgdn_array_get_int_array(const godot_array *array, const godot_int index);
@@ -586,6 +1003,8 @@ HGDN_DECL godot_dictionary hgdn_args_get_dictionary(godot_variant **args, const
 HGDN_DECL godot_array hgdn_args_get_array(godot_variant **args, const godot_int index);
 
 HGDN_DECL hgdn_string hgdn_args_get_string(godot_variant **args, const godot_int index);
+/// @see hgdn_variant_get_string_utf8
+HGDN_DECL hgdn_utf8_string hgdn_args_get_string_utf8(godot_variant **args, const godot_int index, char *buffer, size_t buffer_size);
 HGDN_DECL hgdn_wide_string hgdn_args_get_wide_string(godot_variant **args, const godot_int index);
 HGDN_DECL hgdn_byte_array hgdn_args_get_byte_array(godot_variant **args, const godot_int index);
 HGDN_DECL hgdn_int_array hgdn_args_get_int_array(godot_variant **args, const godot_int index);
@@ -597,8 +1016,49 @@ HGDN_DECL hgdn_string_array hgdn_args_get_string_array(godot_variant **args, con
 /// @}
 
 
+/// @defgroup args_unpack Argument unpacking
+/// Check types and get values from all method arguments at once, driven by a signature string
+///
+/// Each signature code consumes one argument and one output pointer:
+/// - `b`: bool, `godot_bool *`
+/// - `i`, `u`, `f`: int or float, `int64_t *`, `uint64_t *` and `double *` respectively
+/// - `v2`, `v3`, `R`, `P`, `Q`, `A`, `B`, `T2`, `T`, `c`: Vector2, Vector3,
+///   Rect2, Plane, Quat, AABB, Basis, Transform2D, Transform and Color
+/// - `n`, `r`: NodePath and RID
+/// - `o`: Object or null, `godot_object **`
+/// - `d`, `a`: Dictionary and Array, which must be destroyed by the caller
+/// - `s`, `w`: String, `hgdn_string *` and `hgdn_wide_string *`, which must be destroyed by the caller
+/// - `pb`, `pi`, `pf`, `ps`, `pv2`, `pv3`, `pc`: Pool*Arrays as their
+///   `hgdn_*_array` wrappers, which must be destroyed by the caller
+/// - `*`: any Variant, `const godot_variant **` pointing to the argument itself
+///
+/// A `?` after a code marks the argument as optional: if it is missing or null,
+/// its output is left untouched, so initialize it with the default value.
+///
+/// All types are checked before any value is converted, so nothing needs to be
+/// destroyed on failure. On success `NULL` is returned, otherwise an error
+/// message like `"Error: argument 2 should be Vector3, got String"`, which is
+/// valid until the next unpack call in the same thread.
+///
+/// @code
+/// int64_t count; double speed = 1; hgdn_string name;
+/// HGDN_ASSERT_ARGS_UNPACK(args, argc, "isf?", &count, &name, &speed);
+/// @endcode
+/// @{
+HGDN_DECL const char *hgdn_args_unpack(godot_variant **args, const godot_int argc, const char *signature, ...);
+/// @see hgdn_args_unpack
+HGDN_DECL const char *hgdn_array_unpack(const godot_array *array, const char *signature, ...);
+/// Check that there are at least `count` arguments with the given types, without converting them.
+/// `GODOT_VARIANT_TYPE_NIL` accepts any Variant, the rest follow the same rules as `hgdn_args_unpack`.
+HGDN_DECL const char *hgdn_args_check(godot_variant **args, const godot_int argc, const godot_variant_type *types, const godot_int count);
+/// @}
+
+
 /// @defgroup dictionary_get Typed values from Dictionaries
-/// Helper functions to get values directly from a `godot_dictionary` with Variant or String key
+/// Helper functions to get values directly from a `godot_dictionary` with Variant, String or `hgdn_key` key
+///
+/// The `hgdn_dictionary_string_get_*` functions create a temporary key Variant
+/// on each call, prefer `hgdn_dictionary_key_get_*` for keys used repeatedly.
 /// @{
 HGDN_DECL godot_bool hgdn_dictionary_get_bool(const godot_dictionary *dict, const godot_variant *key);
 HGDN_DECL uint64_t hgdn_dictionary_get_uint(const godot_dictionary *dict, const godot_variant *key);
@@ -621,6 +1081,8 @@ HGDN_DECL godot_dictionary hgdn_dictionary_get_dictionary(const godot_dictionary
 HGDN_DECL godot_array hgdn_dictionary_get_array(const godot_dictionary *dict, const godot_variant *key);
 
 HGDN_DECL hgdn_string hgdn_dictionary_get_string(const godot_dictionary *dict, const godot_variant *key);
+/// @see hgdn_variant_get_string_utf8
+HGDN_DECL hgdn_utf8_string hgdn_dictionary_get_string_utf8(const godot_dictionary *dict, const godot_variant *key, char *buffer, size_t buffer_size);
 HGDN_DECL hgdn_wide_string hgdn_dictionary_get_wide_string(const godot_dictionary *dict, const godot_variant *key);
 HGDN_DECL hgdn_byte_array hgdn_dictionary_get_byte_array(const godot_dictionary *dict, const godot_variant *key);
 HGDN_DECL hgdn_int_array hgdn_dictionary_get_int_array(const godot_dictionary *dict, const godot_variant *key);
@@ -651,6 +1113,8 @@ HGDN_DECL godot_dictionary hgdn_dictionary_string_get_dictionary(const godot_dic
 HGDN_DECL godot_array hgdn_dictionary_string_get_array(const godot_dictionary *dict, const char *key);
 
 HGDN_DECL hgdn_string hgdn_dictionary_string_get_string(const godot_dictionary *dict, const char *key);
+/// @see hgdn_variant_get_string_utf8
+HGDN_DECL hgdn_utf8_string hgdn_dictionary_string_get_string_utf8(const godot_dictionary *dict, const char *key, char *buffer, size_t buffer_size);
 HGDN_DECL hgdn_wide_string hgdn_dictionary_string_get_wide_string(const godot_dictionary *dict, const char *key);
 HGDN_DECL hgdn_byte_array hgdn_dictionary_string_get_byte_array(const godot_dictionary *dict, const char *key);
 HGDN_DECL hgdn_int_array hgdn_dictionary_string_get_int_array(const godot_dictionary *dict, const char *key);
@@ -659,6 +1123,82 @@ HGDN_DECL hgdn_vector2_array hgdn_dictionary_string_get_vector2_array(const godo
 HGDN_DECL hgdn_vector3_array hgdn_dictionary_string_get_vector3_array(const godot_dictionary *dict, const char *key);
 HGDN_DECL hgdn_color_array hgdn_dictionary_string_get_color_array(const godot_dictionary *dict, const char *key);
 HGDN_DECL hgdn_string_array hgdn_dictionary_string_get_string_array(const godot_dictionary *dict, const char *key);
+
+HGDN_DECL godot_bool hgdn_dictionary_key_get_bool(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL uint64_t hgdn_dictionary_key_get_uint(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL int64_t hgdn_dictionary_key_get_int(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL double hgdn_dictionary_key_get_real(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_vector2 hgdn_dictionary_key_get_vector2(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_vector3 hgdn_dictionary_key_get_vector3(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_rect2 hgdn_dictionary_key_get_rect2(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_plane hgdn_dictionary_key_get_plane(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_quat hgdn_dictionary_key_get_quat(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_aabb hgdn_dictionary_key_get_aabb(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_basis hgdn_dictionary_key_get_basis(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_transform2d hgdn_dictionary_key_get_transform2d(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_transform hgdn_dictionary_key_get_transform(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_color hgdn_dictionary_key_get_color(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_node_path hgdn_dictionary_key_get_node_path(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_rid hgdn_dictionary_key_get_rid(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_object *hgdn_dictionary_key_get_object(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_dictionary hgdn_dictionary_key_get_dictionary(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL godot_array hgdn_dictionary_key_get_array(const godot_dictionary *dict, hgdn_key key);
+
+HGDN_DECL hgdn_string hgdn_dictionary_key_get_string(const godot_dictionary *dict, hgdn_key key);
+/// @see hgdn_variant_get_string_utf8
+HGDN_DECL hgdn_utf8_string hgdn_dictionary_key_get_string_utf8(const godot_dictionary *dict, hgdn_key key, char *buffer, size_t buffer_size);
+HGDN_DECL hgdn_wide_string hgdn_dictionary_key_get_wide_string(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_byte_array hgdn_dictionary_key_get_byte_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_int_array hgdn_dictionary_key_get_int_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_real_array hgdn_dictionary_key_get_real_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_vector2_array hgdn_dictionary_key_get_vector2_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_vector3_array hgdn_dictionary_key_get_vector3_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_color_array hgdn_dictionary_key_get_color_array(const godot_dictionary *dict, hgdn_key key);
+HGDN_DECL hgdn_string_array hgdn_dictionary_key_get_string_array(const godot_dictionary *dict, hgdn_key key);
+/// @}
+
+
+/// @defgroup string_hash String hashing
+/// 32-bit FNV-1a hash of UTF-8 strings, for dispatching on String arguments without allocations
+///
+/// `HGDN_STRING_HASH` hashes string literals at compile time. In C++11 it is
+/// `constexpr` and may be used as `case` labels. C does not allow that, but
+/// compilers fold it into a constant, so compare it with `==`.
+/// String hashes are computed directly from the characters stored in Godot,
+/// and different strings may have the same hash, so check matches for equality:
+/// ```
+/// switch (hgdn_args_get_string_hash(args, 0)) {
+///     case HGDN_STRING_HASH("jump"):
+///         if (hgdn_args_string_equals(args, 0, "jump")) { ... }
+///         break;
+/// }
+/// ```
+/// @{
+#define HGDN_STRING_HASH_SEED 2166136261u
+#define HGDN_STRING_HASH_PRIME 16777619u
+#if defined(__cplusplus) && __cplusplus >= 201103L
+    constexpr uint32_t hgdn__string_hash_constexpr(const char *s, uint32_t hash) {
+        return *s ? hgdn__string_hash_constexpr(s + 1, (hash ^ (uint8_t) *s) * HGDN_STRING_HASH_PRIME) : hash;
+    }
+    #define HGDN_STRING_HASH(literal)  (hgdn__string_hash_constexpr((literal), HGDN_STRING_HASH_SEED))
+#else
+    // Unrolled for literals up to 64 bytes long, bytes past the end leave the hash unchanged
+    #define HGDN__STRING_HASH_STEP(s, i, hash)  (((hash) ^ (sizeof(s) > (i) + 1 ? (uint8_t) (s)[sizeof(s) > (i) + 1 ? (i) : 0] : 0)) * (sizeof(s) > (i) + 1 ? HGDN_STRING_HASH_PRIME : 1u))
+    #define HGDN__STRING_HASH_4(s, i, hash)  HGDN__STRING_HASH_STEP(s, (i) + 3, HGDN__STRING_HASH_STEP(s, (i) + 2, HGDN__STRING_HASH_STEP(s, (i) + 1, HGDN__STRING_HASH_STEP(s, (i), hash))))
+    #define HGDN__STRING_HASH_16(s, i, hash)  HGDN__STRING_HASH_4(s, (i) + 12, HGDN__STRING_HASH_4(s, (i) + 8, HGDN__STRING_HASH_4(s, (i) + 4, HGDN__STRING_HASH_4(s, (i), hash))))
+    #define HGDN_STRING_HASH(literal)  ((uint32_t) (0 * sizeof(char[sizeof(literal) <= 65 ? 1 : -1]) + \
+        HGDN__STRING_HASH_16(literal, 48, HGDN__STRING_HASH_16(literal, 32, HGDN__STRING_HASH_16(literal, 16, HGDN__STRING_HASH_16(literal, 0, HGDN_STRING_HASH_SEED))))))
+#endif
+/// Hash a NULL terminated UTF-8 string at runtime, same results as `HGDN_STRING_HASH`
+HGDN_DECL uint32_t hgdn_cstring_hash(const char *cstr);
+HGDN_DECL uint32_t hgdn_string_view_hash(hgdn_string_view view);
+HGDN_DECL uint32_t hgdn_string_get_hash(const godot_string *str);
+HGDN_DECL uint32_t hgdn_variant_get_string_hash(const godot_variant *var);
+HGDN_DECL uint32_t hgdn_args_get_string_hash(godot_variant **args, const godot_int index);
+/// Compare String contents with a NULL terminated UTF-8 string, without allocations
+HGDN_DECL godot_bool hgdn_string_view_equals(hgdn_string_view view, const char *cstr);
+HGDN_DECL godot_bool hgdn_variant_string_equals(const godot_variant *var, const char *cstr);
+HGDN_DECL godot_bool hgdn_args_string_equals(godot_variant **args, const godot_int index, const char *cstr);
 /// @}
 
 
@@ -830,6 +1370,40 @@ HGDN_DECL godot_string hgdn_new_wide_string_with_len(const wchar_t *wstr, const
 /// @}
 
 
+/// @defgroup string_builder String builder
+/// Growable UTF-8 buffer for assembling text natively, converted to a String only once at the end
+///
+/// A zero-initialized builder is valid and empty. `ptr` is always NULL terminated after the first append.
+/// Reals and math types are formatted like Godot 3 does when converting them to String,
+/// with 6 decimal places and no trailing zeros.
+/// @{
+typedef struct hgdn_string_builder {
+    char *ptr;
+    godot_int length;
+    godot_int capacity;
+} hgdn_string_builder;
+/// Make sure there is room for `additional` more bytes, returning false if memory could not be allocated
+HGDN_DECL godot_bool hgdn_string_builder_reserve(hgdn_string_builder *builder, const godot_int additional);
+HGDN_DECL void hgdn_string_builder_append(hgdn_string_builder *builder, const char *cstr);
+HGDN_DECL void hgdn_string_builder_append_with_len(hgdn_string_builder *builder, const char *cstr, const godot_int len);
+HGDN_DECL void hgdn_string_builder_append_char(hgdn_string_builder *builder, const char c);
+HGDN_DECL void hgdn_string_builder_appendf(hgdn_string_builder *builder, const char *fmt, ...);
+HGDN_DECL void hgdn_string_builder_append_int(hgdn_string_builder *builder, const int64_t value);
+HGDN_DECL void hgdn_string_builder_append_real(hgdn_string_builder *builder, const double value);
+HGDN_DECL void hgdn_string_builder_append_vector2(hgdn_string_builder *builder, const godot_vector2 value);
+HGDN_DECL void hgdn_string_builder_append_vector3(hgdn_string_builder *builder, const godot_vector3 value);
+HGDN_DECL void hgdn_string_builder_append_color(hgdn_string_builder *builder, const godot_color value);
+HGDN_DECL void hgdn_string_builder_append_basis(hgdn_string_builder *builder, const godot_basis value);
+HGDN_DECL void hgdn_string_builder_append_transform(hgdn_string_builder *builder, const godot_transform value);
+/// Empty the builder, keeping allocated memory for reuse
+HGDN_DECL void hgdn_string_builder_clear(hgdn_string_builder *builder);
+HGDN_DECL void hgdn_string_builder_destroy(hgdn_string_builder *builder);
+HGDN_DECL godot_string hgdn_string_builder_to_string(const hgdn_string_builder *builder);
+/// @note The builder will be destroyed, convenient if it was only used for building this String
+HGDN_DECL godot_string hgdn_string_builder_to_string_own(hgdn_string_builder *builder);
+/// @}
+
+
 /// @defgroup array Pool*Array/Array creation
 /// Helper functions to create Pool*Array/Array objects from sized buffers
 ///
@@ -844,8 +1418,24 @@ HGDN_DECL godot_pool_vector3_array hgdn_new_vector3_array(const godot_vector3 *b
 HGDN_DECL godot_pool_color_array hgdn_new_color_array(const godot_color *buffer, const godot_int size);
 /// @note All strings must be NULL terminated.
 HGDN_DECL godot_pool_string_array hgdn_new_string_array(const char *const *buffer, const godot_int size);
+/// Create a PoolStringArray from `size` UTF-8 strings packed in `data`.
+/// String `i` spans bytes from `offsets[i]` to `offsets[i + 1]`, so `offsets` must have `size + 1` elements.
+HGDN_DECL godot_pool_string_array hgdn_new_string_array_packed(const char *data, const godot_int *offsets, const godot_int size);
+/// Create a PoolStringArray by splitting the UTF-8 `buffer` at every `separator`.
+/// If `len` is negative, `buffer` must be NULL terminated.
+HGDN_DECL godot_pool_string_array hgdn_new_string_array_split(const char *buffer, godot_int len, const char separator);
+/// Create Pool*Arrays with `size` elements to be filled in place with `hgdn_*_array_write_get`.
+/// @note Element values are unspecified, except for Strings which are empty.
+HGDN_DECL godot_pool_byte_array hgdn_new_byte_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_int_array hgdn_new_int_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_real_array hgdn_new_real_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_vector2_array hgdn_new_vector2_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_vector3_array hgdn_new_vector3_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_color_array hgdn_new_color_array_uninit(const godot_int size);
+HGDN_DECL godot_pool_string_array hgdn_new_string_array_uninit(const godot_int size);
 HGDN_DECL godot_array hgdn_new_array(const godot_variant *const *buffer, const godot_int size);
-/// @note Variants in `buffer` will be destroyed, convenient if you create Variants only for constructing the Array
+/// @note Variants in `buffer` are moved into the Array, convenient if you create Variants only for constructing the Array.
+///       They must not be used or destroyed afterwards.
 HGDN_DECL godot_array hgdn_new_array_own(godot_variant *buffer, const godot_int size);
 
 #if defined(__cplusplus) && __cplusplus >= 201103L  // Parameter pack is a C++11 feature
@@ -897,10 +1487,37 @@ extern "C++" {
 /// @}
 
 
+/// @defgroup array_builder Array builder
+/// Growable Array whose elements are constructed in place, converted to a plain Array only once at the end
+///
+/// A zero-initialized builder is valid and empty. Pushed Variants are moved into the Array's own storage
+/// instead of being copied and destroyed, and storage grows geometrically, so pushing is amortized O(1).
+/// @{
+typedef struct hgdn_array_builder {
+    godot_array array;  ///< Only valid after the first push or reserve. Elements past `size` are null.
+    godot_int size;
+    godot_int capacity;
+} hgdn_array_builder;
+/// Make sure there is room for `additional` more elements without resizing the Array again
+HGDN_DECL void hgdn_array_builder_reserve(hgdn_array_builder *builder, const godot_int additional);
+/// Push a null Variant and return it, to be constructed in place with `godot_variant_new_*`.
+/// @warning The returned pointer is only valid until the next push or reserve.
+HGDN_DECL godot_variant *hgdn_array_builder_push_slot(hgdn_array_builder *builder);
+/// Push a copy of `value`
+HGDN_DECL void hgdn_array_builder_push(hgdn_array_builder *builder, const godot_variant *value);
+/// Push `value`, which is moved into the Array and must not be destroyed afterwards
+HGDN_DECL void hgdn_array_builder_push_own(hgdn_array_builder *builder, godot_variant value);
+/// Get the built Array with exactly `size` elements.
+/// @note The builder will be reset, ownership of the Array passes to the caller
+HGDN_DECL godot_array hgdn_array_builder_finish(hgdn_array_builder *builder);
+HGDN_DECL void hgdn_array_builder_destroy(hgdn_array_builder *builder);
+/// @}
+
+
 /// @defgroup dictionary Dictionary creation
 /// Helper functions to create Dictionaries
 ///
-/// The `*_own` functions own the passed Variants, destroying them. Useful
+/// The `*_own` functions own the passed Variants, moving or destroying them. Useful
 /// when you create the Variants just for creating a Dictionary with them.
 /// @{
 typedef struct hgdn_dictionary_entry {
@@ -930,38 +1547,236 @@ typedef struct hgdn_dictionary_entry_string_int {
     godot_int value;
 } hgdn_dictionary_entry_string_int;
 
+typedef struct hgdn_dictionary_entry_key {
+    hgdn_key key;
+    godot_variant *value;
+} hgdn_dictionary_entry_key;
+
+typedef struct hgdn_dictionary_entry_key_own {
+    hgdn_key key;
+    godot_variant value;
+} hgdn_dictionary_entry_key_own;
+
+typedef struct hgdn_dictionary_entry_key_string {
+    hgdn_key key;
+    const char *value;
+} hgdn_dictionary_entry_key_string;
+
+typedef struct hgdn_dictionary_entry_key_int {
+    hgdn_key key;
+    godot_int value;
+} hgdn_dictionary_entry_key_int;
+
 HGDN_DECL godot_dictionary hgdn_new_dictionary(const hgdn_dictionary_entry *buffer, const godot_int size);
 HGDN_DECL godot_dictionary hgdn_new_dictionary_string(const hgdn_dictionary_entry_string *buffer, const godot_int size);
 HGDN_DECL godot_dictionary hgdn_new_dictionary_string_int(const hgdn_dictionary_entry_string_int *buffer, const godot_int size);
 HGDN_DECL godot_dictionary hgdn_new_dictionary_string_string(const hgdn_dictionary_entry_string_string *buffer, const godot_int size);
 HGDN_DECL godot_dictionary hgdn_new_dictionary_own(hgdn_dictionary_entry_own *buffer, const godot_int size);
 HGDN_DECL godot_dictionary hgdn_new_dictionary_string_own(hgdn_dictionary_entry_string_own *buffer, const godot_int size);
+HGDN_DECL godot_dictionary hgdn_new_dictionary_key(const hgdn_dictionary_entry_key *buffer, const godot_int size);
+HGDN_DECL godot_dictionary hgdn_new_dictionary_key_int(const hgdn_dictionary_entry_key_int *buffer, const godot_int size);
+HGDN_DECL godot_dictionary hgdn_new_dictionary_key_string(const hgdn_dictionary_entry_key_string *buffer, const godot_int size);
+HGDN_DECL godot_dictionary hgdn_new_dictionary_key_own(hgdn_dictionary_entry_key_own *buffer, const godot_int size);
+
+#define hgdn_new_dictionary_args(...)  (hgdn_new_dictionary(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry, __VA_ARGS__)))
+#define hgdn_new_dictionary_string_args(...)  (hgdn_new_dictionary_string(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_string, __VA_ARGS__)))
+#define hgdn_new_dictionary_string_int_args(...)  (hgdn_new_dictionary_string_int(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_string_int, __VA_ARGS__)))
+#define hgdn_new_dictionary_string_string_args(...)  (hgdn_new_dictionary_string_string(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_string_string, __VA_ARGS__)))
+#define hgdn_new_dictionary_own_args(...)  (hgdn_new_dictionary_own(HGDN__ARRAY_LITERAL_ARGS(hgdn_dictionary_entry_own, __VA_ARGS__)))
+#define hgdn_new_dictionary_string_own_args(...)  (hgdn_new_dictionary_string_own(HGDN__ARRAY_LITERAL_ARGS(hgdn_dictionary_entry_string_own, __VA_ARGS__)))
+#define hgdn_new_dictionary_key_args(...)  (hgdn_new_dictionary_key(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_key, __VA_ARGS__)))
+#define hgdn_new_dictionary_key_int_args(...)  (hgdn_new_dictionary_key_int(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_key_int, __VA_ARGS__)))
+#define hgdn_new_dictionary_key_string_args(...)  (hgdn_new_dictionary_key_string(HGDN__ARRAY_LITERAL_ARGS(const hgdn_dictionary_entry_key_string, __VA_ARGS__)))
+#define hgdn_new_dictionary_key_own_args(...)  (hgdn_new_dictionary_key_own(HGDN__ARRAY_LITERAL_ARGS(hgdn_dictionary_entry_key_own, __VA_ARGS__)))
+/// @}
+
+
+/// @defgroup struct_dictionary Struct <-> Dictionary conversion
+/// Schema driven conversion between C structs and Dictionaries with String keys
+///
+/// A schema is built once from a NULL-terminated array of field descriptors,
+/// creating the key Variants a single time. Reading looks each field's key up
+/// in the Dictionary, so missing keys are simply skipped and key order doesn't
+/// matter.
+/// @{
+typedef enum hgdn_struct_field_type {
+    HGDN_FIELD_BOOL,  ///< `godot_bool`
+    HGDN_FIELD_INT,  ///< `godot_int`
+    HGDN_FIELD_INT64,  ///< `int64_t`
+    HGDN_FIELD_REAL,  ///< `godot_real`
+    HGDN_FIELD_DOUBLE,  ///< `double`
+    HGDN_FIELD_VECTOR2,
+    HGDN_FIELD_VECTOR3,
+    HGDN_FIELD_RECT2,
+    HGDN_FIELD_PLANE,
+    HGDN_FIELD_QUAT,
+    HGDN_FIELD_AABB,
+    HGDN_FIELD_BASIS,
+    HGDN_FIELD_TRANSFORM2D,
+    HGDN_FIELD_TRANSFORM,
+    HGDN_FIELD_COLOR,
+    HGDN_FIELD_OBJECT,  ///< `godot_object *`, not referenced
+    HGDN_FIELD_STRING,  ///< `godot_string`, must be a valid String. Zero-initialized memory is a valid empty String.
+    HGDN_FIELD_VARIANT,  ///< `godot_variant`, must be a valid Variant. Zero-initialized memory is a valid nil Variant.
+} hgdn_struct_field_type;
+// Field types are packed into the 5 lowest bits of `hgdn_property_field_getter/setter`'s `method_data`
+typedef char hgdn__struct_field_type_fits_5_bits[HGDN_FIELD_VARIANT < 32 ? 1 : -1];
+
+typedef struct hgdn_struct_field {
+    const char *name;
+    size_t offset;
+    hgdn_struct_field_type type;
+} hgdn_struct_field;
 
-#define hgdn_new_dictionary_args(...)  (hgdn_new_dictionary((const hgdn_dictionary_entry[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
-#define hgdn_new_dictionary_string_args(...)  (hgdn_new_dictionary_string((const hgdn_dictionary_entry_string[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
-#define hgdn_new_dictionary_string_int_args(...)  (hgdn_new_dictionary_string_int((const hgdn_dictionary_entry_string_int[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
-#define hgdn_new_dictionary_string_string_args(...)  (hgdn_new_dictionary_string_string((const hgdn_dictionary_entry_string_string[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
-#define hgdn_new_dictionary_own_args(...)  (hgdn_new_dictionary_own((hgdn_dictionary_entry_own[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
-#define hgdn_new_dictionary_string_own_args(...)  (hgdn_new_dictionary_string_own((hgdn_dictionary_entry_string_own[]){ __VA_ARGS__ }, HGDN__NARG(__VA_ARGS__)))
+typedef struct hgdn_struct_schema {
+    const hgdn_struct_field *fields;
+    hgdn_key *keys;
+    godot_int size;
+} hgdn_struct_schema;
+
+/// Helper for a `hgdn_struct_field` literal describing `field` from struct `ctype`
+#define hgdn_struct_field_entry(ctype, field, type)  { #field, offsetof(ctype, field), (type) }
+/// Helper for a literal NULL-terminated array of `hgdn_struct_field`
+#define hgdn_struct_fields(...)  ((const hgdn_struct_field[]){ __VA_ARGS__, { NULL } })
+
+/// Create a schema from a NULL-terminated array of fields. `fields` must outlive the schema.
+HGDN_DECL hgdn_struct_schema hgdn_new_struct_schema(const hgdn_struct_field *fields);
+HGDN_DECL void hgdn_struct_schema_destroy(hgdn_struct_schema *schema);
+/// Read fields present in `dict` into `data`, returning how many fields were read.
+/// Costs at most two engine calls per field, regardless of the Dictionary's size or key order.
+HGDN_DECL godot_int hgdn_struct_from_dictionary(void *data, const hgdn_struct_schema *schema, const godot_dictionary *dict);
+HGDN_DECL godot_dictionary hgdn_struct_to_dictionary(const void *data, const hgdn_struct_schema *schema);
 /// @}
 
 
 /// @defgroup object Object functions
 /// Helper functions to work with `godot_object` values
+///
+/// Method and property names are interned using `hgdn_intern_string`.
 /// @{
 HGDN_DECL godot_variant hgdn_object_callv(godot_object *instance, const char *method, const godot_array *args);
 HGDN_DECL godot_variant hgdn_object_callv_own(godot_object *instance, const char *method, godot_array args);
-#define hgdn_object_get(instance, property)  (hgdn_object_call(instance, "get", property))
-#define hgdn_object_set(instance, property, value)  (hgdn_object_call(instance, "set", property, value))
+/// Call `method` passing `argc` Variants directly to Object's `call` method bind, without an intermediate Array.
+/// The argument pointer array is built on the stack for up to `HGDN_OBJECT_CALL_STACK_ARGS_MAX` arguments.
+HGDN_DECL godot_variant hgdn_object_callp(godot_object *instance, const char *method, const godot_variant *const *args, const godot_int argc);
+/// @note Variants in `args` will be destroyed, convenient if you create Variants only for calling the method
+HGDN_DECL godot_variant hgdn_object_callp_own(godot_object *instance, const char *method, godot_variant *args, const godot_int argc);
+/// Get a property by its C string name, calling Object's `get` method bind directly.
+HGDN_DECL godot_variant hgdn_object_get_named(godot_object *instance, const char *property);
+HGDN_DECL void hgdn_object_set_named_variant(godot_object *instance, const char *property, const godot_variant *value);
+/// @note `value` will be destroyed, convenient if you create the Variant only for setting the property
+HGDN_DECL void hgdn_object_set_named_own(godot_object *instance, const char *property, godot_variant value);
+/// @note In C++ and C11 the value passed is transformed by `hgdn_new_variant`, so primitive C data can be passed directly
+#define hgdn_object_set_named(instance, property, value)  (hgdn_object_set_named_own((instance), (property), hgdn_new_variant((value))))
 
 #if defined(__cplusplus) && __cplusplus >= 201103L  // Parameter pack is a C++11 feature
 extern "C++" template<typename... Args> godot_variant hgdn_object_call(godot_object *instance, const char *method, Args... args) {
-    godot_array args_array = hgdn_new_array_args(args...);
-    return hgdn_object_callv_own(instance, method, args_array);
+    // Extra slot avoids zero-sized arrays when there are no arguments
+    godot_variant args_buffer[sizeof...(Args) + 1] = { hgdn_new_variant(args)... };
+    return hgdn_object_callp_own(instance, method, args_buffer, sizeof...(Args));
 }
 #else
 /// @note In C++ and C11 the arguments passed are transformed by `hgdn_new_variant`, so primitive C data can be passed directly
-#define hgdn_object_call(instance, method, ...)  (hgdn_object_callv_own((instance), (method), hgdn_new_array_args(__VA_ARGS__)))
+#define hgdn_object_call(instance, method, ...)  (hgdn_object_callp_own((instance), (method), (godot_variant[]){ HGDN__MAP(hgdn_new_variant, __VA_ARGS__) }, HGDN__NARG(__VA_ARGS__)))
+#endif
+HGDN_DECL godot_variant hgdn__object_set_named_own(godot_object *instance, const char *property, godot_variant value);
+/// `property` may be anything convertible by `hgdn_new_variant`, like a C string, a `godot_string` or a `godot_node_path`.
+/// @note In C++ and C11 C string properties use the interned names of `hgdn_object_get_named` and `hgdn_object_set_named`,
+///       other properties are passed to Object's `get` and `set` through `hgdn_object_call`
+#if defined(__cplusplus) && __cplusplus >= 201103L
+extern "C++" {
+    inline godot_variant hgdn_object_get(godot_object *instance, const char *property) {
+        return hgdn_object_get_named(instance, property);
+    }
+    inline godot_variant hgdn_object_get(godot_object *instance, char *property) {
+        return hgdn_object_get_named(instance, property);
+    }
+    template<typename Property> godot_variant hgdn_object_get(godot_object *instance, Property property) {
+        return hgdn_object_call(instance, "get", property);
+    }
+    template<typename T> godot_variant hgdn_object_set(godot_object *instance, const char *property, T value) {
+        return hgdn__object_set_named_own(instance, property, hgdn_new_variant(value));
+    }
+    template<typename T> godot_variant hgdn_object_set(godot_object *instance, char *property, T value) {
+        return hgdn__object_set_named_own(instance, property, hgdn_new_variant(value));
+    }
+    template<typename Property, typename T> godot_variant hgdn_object_set(godot_object *instance, Property property, T value) {
+        return hgdn_object_call(instance, "set", property, value);
+    }
+}
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L  // C11
+// Every association must compile for any property type, even though only the selected one is evaluated
+#define hgdn__cstring_or_null(property)  (_Generic((property), char*: (property), const char*: (property), default: (const char *) NULL))
+#define hgdn_object_get(instance, property) \
+    (_Generic((property), \
+        char*: hgdn_object_get_named((instance), hgdn__cstring_or_null(property)), \
+        const char*: hgdn_object_get_named((instance), hgdn__cstring_or_null(property)), \
+        default: hgdn_object_call(instance, "get", property) \
+    ))
+#define hgdn_object_set(instance, property, value) \
+    (_Generic((property), \
+        char*: hgdn__object_set_named_own((instance), hgdn__cstring_or_null(property), hgdn_new_variant((value))), \
+        const char*: hgdn__object_set_named_own((instance), hgdn__cstring_or_null(property), hgdn_new_variant((value))), \
+        default: hgdn_object_call(instance, "set", property, value) \
+    ))
+#else
+#define hgdn_object_get(instance, property)  (hgdn_object_call(instance, "get", property))
+#define hgdn_object_set(instance, property, value)  (hgdn_object_call(instance, "set", property, value))
+#endif
+/// @}
+
+
+/// @defgroup method_bind Method binds
+/// Cached method bind lookup and typed `ptrcall` wrappers
+///
+/// Calling methods through their binds skips the name lookup, argument Array
+/// and Variant boxing done by `hgdn_object_callv`. Arguments are passed as an
+/// array of pointers to values encoded just like Godot expects them in
+/// `ptrcall`: `godot_bool` for bool, `int64_t` for int, `double` for float,
+/// `godot_object *` for objects and pointers to math types, Strings and other
+/// builtin types otherwise.
+/// @{
+/// Get a method bind, caching the result of `godot_method_bind_get_method`.
+/// Safe to call from any thread, returns NULL if the method is not found.
+/// @note Keep the returned pointer around on hot paths, looking it up is cheap but not free.
+HGDN_DECL godot_method_bind *hgdn_method_bind_get(const char *classname, const char *methodname);
+
+HGDN_DECL void hgdn_method_bind_ptrcall(godot_method_bind *method_bind, godot_object *instance, const void **args, void *ret);
+HGDN_DECL godot_bool hgdn_method_bind_ptrcall_bool(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL int64_t hgdn_method_bind_ptrcall_int(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL double hgdn_method_bind_ptrcall_real(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_vector2 hgdn_method_bind_ptrcall_vector2(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_vector3 hgdn_method_bind_ptrcall_vector3(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_rect2 hgdn_method_bind_ptrcall_rect2(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_plane hgdn_method_bind_ptrcall_plane(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_quat hgdn_method_bind_ptrcall_quat(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_aabb hgdn_method_bind_ptrcall_aabb(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_basis hgdn_method_bind_ptrcall_basis(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_transform2d hgdn_method_bind_ptrcall_transform2d(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_transform hgdn_method_bind_ptrcall_transform(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_color hgdn_method_bind_ptrcall_color(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_rid hgdn_method_bind_ptrcall_rid(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_object *hgdn_method_bind_ptrcall_object(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_string hgdn_method_bind_ptrcall_string(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_variant hgdn_method_bind_ptrcall_variant(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_dictionary hgdn_method_bind_ptrcall_dictionary(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_array hgdn_method_bind_ptrcall_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_byte_array hgdn_method_bind_ptrcall_pool_byte_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_int_array hgdn_method_bind_ptrcall_pool_int_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_real_array hgdn_method_bind_ptrcall_pool_real_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_string_array hgdn_method_bind_ptrcall_pool_string_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_vector2_array hgdn_method_bind_ptrcall_pool_vector2_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_vector3_array hgdn_method_bind_ptrcall_pool_vector3_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+HGDN_DECL godot_pool_color_array hgdn_method_bind_ptrcall_pool_color_array(godot_method_bind *method_bind, godot_object *instance, const void **args);
+
+/// Helper for a literal array of `ptrcall` argument pointers, may be called with no arguments.
+/// @warning In C++ the array is backed by a temporary `std::initializer_list`,
+///          so it is only valid until the end of the full expression.
+///          Pass it directly to the `ptrcall` function, never store it in a variable.
+#if defined(__cplusplus) && __cplusplus >= 201103L  // Array compound literals can't be used as pointers in C++
+#define hgdn_ptrcall_args(...)  (const_cast<const void **>((std::initializer_list<const void *>{ __VA_ARGS__ }).begin()))
+#else  // Leading NULL keeps the initializer non-empty when called with no arguments
+#define hgdn_ptrcall_args(...)  ((const void *[]){ NULL, __VA_ARGS__ } + 1)
 #endif
 /// @}
 
@@ -1065,11 +1880,284 @@ HGDN_DECL void hgdn_instance_free(godot_object *instance, void *method_data, voi
 /// Create a `godot_instance_destroy_func` that frees instance data
 #define hgdn_instance_destroy_func_free() ((const godot_instance_destroy_func){ &hgdn_instance_free })
 
+/// Instance allocator that recycles fixed size slots from big chunks of memory, avoiding heap churn
+/// for classes whose instances are created and destroyed all the time.
+///
+/// Slots are rounded up to a power of two up to `HGDN_CACHE_LINE_SIZE` bytes, or to a multiple of it
+/// for bigger instances, and chunks are aligned to cache lines, so instances never share cache lines
+/// needlessly. Chunk memory is only released when the pool is destroyed, which happens when the
+/// class is unregistered if created by `hgdn_instance_create_func_pool`.
+typedef struct hgdn_instance_pool hgdn_instance_pool;
+
+typedef struct hgdn_instance_pool_stats {
+    int64_t live;  ///< Instances currently allocated
+    int64_t peak;  ///< Maximum number of instances allocated at the same time
+    int64_t capacity;  ///< Number of slots in allocated chunks
+    int64_t chunks;  ///< Number of allocated chunks
+} hgdn_instance_pool_stats;
+
+/// Create a pool for instances of `instance_size` bytes, allocating `chunk_size` slots at a time
+HGDN_DECL hgdn_instance_pool *hgdn_instance_pool_new(size_t instance_size, godot_int chunk_size);
+/// Destroy `pool`, releasing all of its memory. Usable as `free_func`.
+HGDN_DECL void hgdn_instance_pool_destroy(void *pool);
+HGDN_DECL hgdn_instance_pool_stats hgdn_instance_pool_get_stats(hgdn_instance_pool *pool);
+/// Get zero-initialized instance data from the pool passed as `method_data`, to be used as instance create function
+HGDN_DECL void *hgdn_instance_pool_alloc(godot_object *instance, void *pool);
+/// Return instance data to the pool passed as `method_data`, to be used as instance destroy function.
+/// `hgdn_register_class` fills a NULL `method_data` with the pool used by the class' create function.
+HGDN_DECL void hgdn_instance_pool_free(godot_object *instance, void *pool, void *data);
+/// Create a `godot_instance_create_func` that allocates zero-initialized `ctype` from a new instance pool.
+/// The pool is available as the `method_data` field, for example for calling `hgdn_instance_pool_get_stats`.
+#define hgdn_instance_create_func_pool(ctype) (hgdn_instance_create_func_pool_chunk(ctype, HGDN_INSTANCE_POOL_CHUNK_SIZE))
+/// @see hgdn_instance_create_func_pool
+#define hgdn_instance_create_func_pool_chunk(ctype, chunk_size) ((const godot_instance_create_func){ &hgdn_instance_pool_alloc, (void *) hgdn_instance_pool_new(sizeof(ctype), (chunk_size)), &hgdn_instance_pool_destroy })
+/// Create a `godot_instance_destroy_func` that returns instance data to the pool from `hgdn_instance_create_func_pool`
+#define hgdn_instance_destroy_func_pool() ((const godot_instance_destroy_func){ &hgdn_instance_pool_free })
+
 HGDN_DECL godot_variant *hgdn_property_constant_alloc(godot_variant value);
 HGDN_DECL void hgdn_property_constant_free(void *value);
 HGDN_DECL godot_variant hgdn_property_constant_get(godot_object *instance, void *value, void *data);
 /// @note In C++ and C11 the value passed is transformed by `hgdn_new_variant`, so primitive C data can be passed directly
 #define hgdn_property_constant(value)  ((const godot_property_get_func){ &hgdn_property_constant_get, (void *) hgdn_property_constant_alloc(hgdn_new_variant((value))), &hgdn_property_constant_free })
+
+/// Property getter/setter functions that read and write a struct field in the instance data directly.
+/// For the plain versions, `method_data` packs field offset and type, so no memory is allocated at all.
+/// @see hgdn_property_field
+HGDN_DECL godot_variant hgdn_property_field_get(godot_object *instance, void *method_data, void *data);
+HGDN_DECL void hgdn_property_field_set(godot_object *instance, void *method_data, void *data, godot_variant *value);
+
+/// Struct field property with clamping and change notification, used as the setter's `method_data`
+typedef struct hgdn_property_field_info {
+    size_t offset;
+    hgdn_struct_field_type type;
+    /// Integer and floating point fields are clamped to [min, max] when `min < max`
+    double min, max;
+    /// Called after the field is set, if not NULL.
+    /// Only called when the value changed, except for String and Variant fields, which always notify.
+    void (*on_change)(godot_object *instance, void *data, const struct hgdn_property_field_info *field);
+} hgdn_property_field_info;
+
+HGDN_DECL hgdn_property_field_info *hgdn_property_field_info_alloc(size_t offset, hgdn_struct_field_type type, double min, double max, void (*on_change)(godot_object *, void *, const hgdn_property_field_info *));
+HGDN_DECL void hgdn_property_field_set_ex(godot_object *instance, void *method_data, void *data, godot_variant *value);
+/// Variant type used to register a struct field of the given type
+HGDN_DECL godot_int hgdn_struct_field_variant_type(hgdn_struct_field_type type);
+
+#define HGDN__PROPERTY_FIELD_DATA(ctype, field, type)  ((void *) (((uintptr_t) offsetof(ctype, field) << 5) | (uintptr_t) (type)))
+/// Create a `godot_property_get_func` that returns `field` from struct `ctype`
+#define hgdn_property_field_getter(ctype, field, type)  ((const godot_property_get_func){ &hgdn_property_field_get, HGDN__PROPERTY_FIELD_DATA(ctype, field, type), NULL })
+/// Create a `godot_property_set_func` that sets `field` from struct `ctype`
+#define hgdn_property_field_setter(ctype, field, type)  ((const godot_property_set_func){ &hgdn_property_field_set, HGDN__PROPERTY_FIELD_DATA(ctype, field, type), NULL })
+/// Create a `godot_property_set_func` that sets `field` from struct `ctype`, clamping the value and calling `on_change`.
+/// If allocating its `method_data` fails, the setter does nothing.
+#define hgdn_property_field_setter_ex(ctype, field, type, min, max, on_change)  ((const godot_property_set_func){ &hgdn_property_field_set_ex, hgdn_property_field_info_alloc(offsetof(ctype, field), (type), (min), (max), (on_change)), &hgdn_free })
+/// Helper for the first members of a `hgdn_property_info` exposing `field` from struct `ctype`:
+/// path, setter, getter and Variant type. Other members may follow, like hint and usage.
+/// @code
+/// hgdn_properties(
+///     { hgdn_property_field(Player, speed, HGDN_FIELD_REAL) },
+///     { hgdn_property_field_ex(Player, health, HGDN_FIELD_INT, 0, 100, &on_health_changed) }
+/// )
+/// @endcode
+#define hgdn_property_field(ctype, field, type)  #field, hgdn_property_field_setter(ctype, field, type), hgdn_property_field_getter(ctype, field, type), hgdn_struct_field_variant_type((type))
+/// @see hgdn_property_field, hgdn_property_field_setter_ex
+#define hgdn_property_field_ex(ctype, field, type, min, max, on_change)  #field, hgdn_property_field_setter_ex(ctype, field, type, min, max, on_change), hgdn_property_field_getter(ctype, field, type), hgdn_struct_field_variant_type((type))
+
+#if defined(__cplusplus) && __cplusplus >= 201103L  // Parameter pack is a C++11 feature
+/// @name Typed method trampolines
+/// `hgdn_method<&MyStruct::move>("move")` creates a `hgdn_method_info` whose
+/// method checks arguments count and types, converts them, calls `MyStruct::move`
+/// on the instance data and returns its result converted by `hgdn_new_variant`.
+///
+/// Both member functions and functions receiving the instance data pointer as
+/// first parameter are supported. In C++11, pass the function type explicitly:
+/// `hgdn_method<decltype(&MyStruct::move), &MyStruct::move>("move")`.
+///
+/// Supported parameter types are bool, integers, enums, floating point numbers,
+/// math types, `godot_object *`, `const char *`, `const godot_variant *` and
+/// the reference counted types like `godot_string` and `godot_array`.
+/// Arguments are destroyed after the call, so methods must not destroy them.
+/// `name` must outlive the registered class, since it is used in error messages.
+/// @{
+extern "C++" {
+    template<size_t... I> struct hgdn__index_sequence {};
+    template<size_t N, size_t... I> struct hgdn__make_index_sequence : hgdn__make_index_sequence<N - 1, N - 1, I...> {};
+    template<size_t... I> struct hgdn__make_index_sequence<0, I...> : hgdn__index_sequence<I...> {};
+
+    // Converts an argument to `T`, destroying anything it had to create when the call ends
+    template<typename T, typename = void> struct hgdn__method_arg;
+    template<typename T> struct hgdn__method_arg<T, typename std::enable_if<std::is_same<T, bool>::value>::type> {
+        static const godot_variant_type type = GODOT_VARIANT_TYPE_BOOL;
+        T value;
+        hgdn__method_arg(const godot_variant *var) : value(hgdn_variant_get_bool(var)) {}
+        T& get() { return value; }
+    };
+    template<typename T> struct hgdn__method_arg<T, typename std::enable_if<(std::is_integral<T>::value || std::is_enum<T>::value) && !std::is_same<T, bool>::value>::type> {
+        static const godot_variant_type type = GODOT_VARIANT_TYPE_INT;
+        T value;
+        hgdn__method_arg(const godot_variant *var) : value((T) hgdn_variant_get_int(var)) {}
+        T& get() { return value; }
+    };
+    template<typename T> struct hgdn__method_arg<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+        static const godot_variant_type type = GODOT_VARIANT_TYPE_REAL;
+        T value;
+        hgdn__method_arg(const godot_variant *var) : value((T) hgdn_variant_get_real(var)) {}
+        T& get() { return value; }
+    };
+    template<> struct hgdn__method_arg<const char *> {
+        static const godot_variant_type type = GODOT_VARIANT_TYPE_STRING;
+        hgdn_string value;
+        hgdn__method_arg(const godot_variant *var) : value(hgdn_variant_get_string(var)) {}
+        ~hgdn__method_arg() { hgdn_string_destroy(&value); }
+        const char *get() { return value.ptr; }
+    };
+    template<> struct hgdn__method_arg<const godot_variant *> {
+        static const godot_variant_type type = GODOT_VARIANT_TYPE_NIL;  // any Variant
+        const godot_variant *value;
+        hgdn__method_arg(const godot_variant *var) : value(var) {}
+        const godot_variant *get() { return value; }
+    };
+#define HGDN__METHOD_ARG(kind, ctype, variant_type) \
+    template<> struct hgdn__method_arg<ctype> { \
+        static const godot_variant_type type = variant_type; \
+        ctype value; \
+        hgdn__method_arg(const godot_variant *var) : value(hgdn_variant_get_##kind(var)) {} \
+        ctype& get() { return value; } \
+    };
+#define HGDN__METHOD_ARG_OWN(kind, ctype, variant_type) \
+    template<> struct hgdn__method_arg<ctype> { \
+        static const godot_variant_type type = variant_type; \
+        ctype value; \
+        hgdn__method_arg(const godot_variant *var) : value(hgdn_core_api->godot_variant_as_##kind(var)) {} \
+        ~hgdn__method_arg() { hgdn_core_api->godot_##kind##_destroy(&value); } \
+        ctype& get() { return value; } \
+    };
+    HGDN__METHOD_ARG(vector2, godot_vector2, GODOT_VARIANT_TYPE_VECTOR2)
+    HGDN__METHOD_ARG(vector3, godot_vector3, GODOT_VARIANT_TYPE_VECTOR3)
+    HGDN__METHOD_ARG(rect2, godot_rect2, GODOT_VARIANT_TYPE_RECT2)
+    HGDN__METHOD_ARG(plane, godot_plane, GODOT_VARIANT_TYPE_PLANE)
+    HGDN__METHOD_ARG(quat, godot_quat, GODOT_VARIANT_TYPE_QUAT)
+    HGDN__METHOD_ARG(aabb, godot_aabb, GODOT_VARIANT_TYPE_AABB)
+    HGDN__METHOD_ARG(basis, godot_basis, GODOT_VARIANT_TYPE_BASIS)
+    HGDN__METHOD_ARG(transform2d, godot_transform2d, GODOT_VARIANT_TYPE_TRANSFORM2D)
+    HGDN__METHOD_ARG(transform, godot_transform, GODOT_VARIANT_TYPE_TRANSFORM)
+    HGDN__METHOD_ARG(color, godot_color, GODOT_VARIANT_TYPE_COLOR)
+    HGDN__METHOD_ARG(rid, godot_rid, GODOT_VARIANT_TYPE_RID)
+    HGDN__METHOD_ARG(object, godot_object *, GODOT_VARIANT_TYPE_OBJECT)
+    HGDN__METHOD_ARG_OWN(string, godot_string, GODOT_VARIANT_TYPE_STRING)
+    HGDN__METHOD_ARG_OWN(node_path, godot_node_path, GODOT_VARIANT_TYPE_NODE_PATH)
+    HGDN__METHOD_ARG_OWN(dictionary, godot_dictionary, GODOT_VARIANT_TYPE_DICTIONARY)
+    HGDN__METHOD_ARG_OWN(array, godot_array, GODOT_VARIANT_TYPE_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_byte_array, godot_pool_byte_array, GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_int_array, godot_pool_int_array, GODOT_VARIANT_TYPE_POOL_INT_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_real_array, godot_pool_real_array, GODOT_VARIANT_TYPE_POOL_REAL_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_string_array, godot_pool_string_array, GODOT_VARIANT_TYPE_POOL_STRING_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_vector2_array, godot_pool_vector2_array, GODOT_VARIANT_TYPE_POOL_VECTOR2_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_vector3_array, godot_pool_vector3_array, GODOT_VARIANT_TYPE_POOL_VECTOR3_ARRAY)
+    HGDN__METHOD_ARG_OWN(pool_color_array, godot_pool_color_array, GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY)
+#undef HGDN__METHOD_ARG_OWN
+#undef HGDN__METHOD_ARG
+
+    // Integral and floating point results are widened before boxing, since types like `long long`,
+    // `long` or `float` would make `hgdn_new_variant` overload resolution ambiguous
+    template<typename T> typename std::enable_if<(std::is_integral<T>::value || std::is_enum<T>::value) && !std::is_same<T, bool>::value, godot_variant>::type hgdn__method_return(T value) {
+        return hgdn_new_variant(static_cast<int64_t>(value));
+    }
+    template<typename T> typename std::enable_if<std::is_floating_point<T>::value, godot_variant>::type hgdn__method_return(T value) {
+        return hgdn_new_variant(static_cast<double>(value));
+    }
+    template<typename T> typename std::enable_if<(!std::is_arithmetic<T>::value && !std::is_enum<T>::value) || std::is_same<T, bool>::value, godot_variant>::type hgdn__method_return(T value) {
+        return hgdn_new_variant(value);
+    }
+
+    // `Impl::invoke` calls the wrapped function, the rest is shared by all kinds of functions
+    template<typename Impl, typename C, typename R, typename... Args> struct hgdn__method_trampoline {
+        template<size_t... I> static godot_variant call(C *self, godot_variant **args, hgdn__index_sequence<I...>, std::false_type) {
+            return hgdn__method_return(Impl::invoke(self, hgdn__method_arg<typename std::decay<Args>::type>(args[I]).get()...));
+        }
+        template<size_t... I> static godot_variant call(C *self, godot_variant **args, hgdn__index_sequence<I...>, std::true_type) {
+            Impl::invoke(self, hgdn__method_arg<typename std::decay<Args>::type>(args[I]).get()...);
+            return hgdn_new_nil_variant();
+        }
+        static godot_variant method(godot_object *instance, void *method_data, void *user_data, int argc, godot_variant **args) {
+            // Extra slot avoids zero-sized arrays when there are no arguments
+            static const godot_variant_type types[sizeof...(Args) + 1] = { hgdn__method_arg<typename std::decay<Args>::type>::type... };
+            const char *error = hgdn_args_check(args, argc, types, sizeof...(Args));
+            if (error) {
+                HGDN_PRINT_ERROR("%s: %s", (const char *) method_data, error);
+                return hgdn_new_nil_variant();
+            }
+            return call((C *) user_data, args, hgdn__make_index_sequence<sizeof...(Args)>(), typename std::is_void<R>::type());
+        }
+    };
+
+    template<typename F, F M> struct hgdn__method;
+    template<typename C, typename R, typename... Args, R (C::*M)(Args...)> struct hgdn__method<R (C::*)(Args...), M>
+        : hgdn__method_trampoline<hgdn__method<R (C::*)(Args...), M>, C, R, Args...> {
+        template<typename... Values> static R invoke(C *self, Values&&... values) { return (self->*M)(values...); }
+    };
+    template<typename C, typename R, typename... Args, R (C::*M)(Args...) const> struct hgdn__method<R (C::*)(Args...) const, M>
+        : hgdn__method_trampoline<hgdn__method<R (C::*)(Args...) const, M>, C, R, Args...> {
+        template<typename... Values> static R invoke(C *self, Values&&... values) { return (self->*M)(values...); }
+    };
+    template<typename C, typename R, typename... Args, R (*M)(C *, Args...)> struct hgdn__method<R (*)(C *, Args...), M>
+        : hgdn__method_trampoline<hgdn__method<R (*)(C *, Args...), M>, C, R, Args...> {
+        template<typename... Values> static R invoke(C *self, Values&&... values) { return M(self, values...); }
+    };
+
+    template<typename F, F M> hgdn_method_info hgdn_method(const char *name) {
+        hgdn_method_info method_info = {};
+        method_info.name = name;
+        method_info.method.method = &hgdn__method<F, M>::method;
+        method_info.method.method_data = (void *) name;
+        return method_info;
+    }
+#ifdef __cpp_nontype_template_parameter_auto
+    template<auto M> hgdn_method_info hgdn_method(const char *name) {
+        return hgdn_method<decltype(M), M>(name);
+    }
+#endif
+}
+/// @}
+#endif
+#endif  // HGDN_NO_EXT_NATIVESCRIPT
+/// @}
+
+
+/// @defgroup profile NativeScript profiler
+/// Call counts and latencies of NativeScript methods and properties
+///
+/// If `HGDN_PROFILE` is defined, `hgdn_register_class` wraps every method, property getter and setter
+/// in a timing shim. Each thread records into its own counters, so profiling never locks, and keeps
+/// its last `HGDN_PROFILE_TRACE_EVENTS` calls for exporting as Chrome trace events (`chrome://tracing`).
+/// Otherwise, no shims are installed and functions report nothing.
+/// @{
+#ifndef HGDN_NO_EXT_NATIVESCRIPT
+/// Number of latency histogram buckets: up to 1 us, up to 2 us, up to 4 us, ... and bigger than 16 ms
+#define HGDN_PROFILE_HISTOGRAM_BUCKETS 16
+
+typedef struct hgdn_profile_stats {
+    const char *name;  ///< "Class::method", "Class::property (get)" or "Class::property (set)"
+    int64_t calls;
+    int64_t total_ns;
+    int64_t min_ns;
+    int64_t max_ns;
+    int64_t histogram[HGDN_PROFILE_HISTOGRAM_BUCKETS];
+} hgdn_profile_stats;
+
+/// Number of profiled methods and properties
+HGDN_DECL godot_int hgdn_profile_get_count();
+/// Fill `buffer` with the stats of at most `size` profiled methods and properties, returning how many were filled
+HGDN_DECL godot_int hgdn_profile_get_stats(hgdn_profile_stats *buffer, const godot_int size);
+/// Create a Dictionary with profiled names as keys and Dictionaries with each one's stats as values
+HGDN_DECL godot_dictionary hgdn_profile_to_dictionary();
+/// Append recorded calls to `builder` as a Chrome trace event JSON object
+HGDN_DECL void hgdn_profile_append_trace_json(hgdn_string_builder *builder);
+/// Create a String with recorded calls as a Chrome trace event JSON object
+HGDN_DECL godot_string hgdn_profile_trace_json();
+/// Native call that returns the profile Dictionary, to be called with `call_native("standard_varcall", ...)`
+HGDN_DECL godot_variant hgdn_profile_native_call(godot_array *args);
+/// NativeScript method that returns the profile Dictionary
+HGDN_DECL godot_variant hgdn_profile_method(godot_object *instance, void *method_data, void *data, int argc, godot_variant **args);
 #endif  // HGDN_NO_EXT_NATIVESCRIPT
 /// @}
 
@@ -1083,9 +2171,100 @@ HGDN_DECL godot_variant hgdn_property_constant_get(godot_object *instance, void
 
 #ifdef HGDN_IMPLEMENTATION
 
+#include <limits.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <string.h>
+#ifdef HGDN_PROFILE
+    #include <time.h>
+#endif
+
+#if !defined(HGDN_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define HGDN__SSE2
+    #include <emmintrin.h>
+    #ifdef __AVX2__
+        #define HGDN__AVX2
+        #include <immintrin.h>
+    #endif
+    #if WCHAR_MAX > 0xFFFF
+        #define HGDN__WIDE_PER_M128 4
+        #define HGDN__WIDE_SET1(v)  _mm_set1_epi32((v))
+        #define HGDN__WIDE_CMPEQ(a, b)  _mm_cmpeq_epi32((a), (b))
+    #else
+        #define HGDN__WIDE_PER_M128 8
+        #define HGDN__WIDE_SET1(v)  _mm_set1_epi16((v))
+        #define HGDN__WIDE_CMPEQ(a, b)  _mm_cmpeq_epi16((a), (b))
+    #endif
+#endif
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+    typedef SRWLOCK hgdn__mutex;
+    #define HGDN__MUTEX_INITIALIZER  SRWLOCK_INIT
+    #define hgdn__mutex_lock(m)  AcquireSRWLockExclusive((m))
+    #define hgdn__mutex_unlock(m)  ReleaseSRWLockExclusive((m))
+#else
+    #include <pthread.h>
+    #include <sched.h>
+    typedef pthread_mutex_t hgdn__mutex;
+    #define HGDN__MUTEX_INITIALIZER  PTHREAD_MUTEX_INITIALIZER
+    #define hgdn__mutex_lock(m)  pthread_mutex_lock((m))
+    #define hgdn__mutex_unlock(m)  pthread_mutex_unlock((m))
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #define hgdn__atomic_load(p)  InterlockedCompareExchange64((volatile LONG64 *) (p), 0, 0)
+    #define hgdn__atomic_store(p, v)  InterlockedExchange64((volatile LONG64 *) (p), (v))
+    #define hgdn__atomic_cas(p, expected, desired)  (InterlockedCompareExchange64((volatile LONG64 *) (p), (desired), (expected)) == (expected))
+    #define hgdn__atomic_increment(p)  InterlockedIncrement64((volatile LONG64 *) (p))
+    #define hgdn__atomic_add(p, v)  (InterlockedExchangeAdd64((volatile LONG64 *) (p), (v)) + (v))
+    // Counters only written by their owner thread and read by others
+    #define hgdn__counter_add(p, v)  (*(volatile int64_t *) (p) += (v))
+    #define hgdn__counter_store(p, v)  (*(volatile int64_t *) (p) = (v))
+    #define hgdn__atomic_load_ptr(p)  InterlockedCompareExchangePointer((PVOID volatile *) (p), NULL, NULL)
+    #define hgdn__atomic_store_ptr(p, v)  InterlockedExchangePointer((PVOID volatile *) (p), (v))
+    #define hgdn__atomic_store_int_relaxed(p, v)  (*(volatile int *) (p) = (v))
+    // Sequentially consistent operations, for handshakes where each side stores one variable and loads the other
+    #define hgdn__atomic_increment_seq_cst(p)  InterlockedIncrement64((volatile LONG64 *) (p))
+    #define hgdn__atomic_load_seq_cst(p)  InterlockedCompareExchange64((volatile LONG64 *) (p), 0, 0)
+    #define hgdn__atomic_exchange_ptr_seq_cst(p, v)  InterlockedExchangePointer((PVOID volatile *) (p), (v))
+    #define hgdn__atomic_load_ptr_seq_cst(p)  InterlockedCompareExchangePointer((PVOID volatile *) (p), NULL, NULL)
+    #define hgdn__yield()  SwitchToThread()
+#else
+    static inline godot_bool hgdn__atomic_cas_impl(int64_t *p, int64_t expected, int64_t desired) {
+        return __atomic_compare_exchange_n(p, &expected, desired, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+    }
+    #define hgdn__atomic_load(p)  __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define hgdn__atomic_store(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define hgdn__atomic_cas(p, expected, desired)  hgdn__atomic_cas_impl((p), (expected), (desired))
+    #define hgdn__atomic_increment(p)  __atomic_add_fetch((p), 1, __ATOMIC_RELAXED)
+    #define hgdn__atomic_add(p, v)  __atomic_add_fetch((p), (v), __ATOMIC_RELAXED)
+    // Counters only written by their owner thread and read by others
+    #define hgdn__counter_add(p, v)  __atomic_store_n((p), __atomic_load_n((p), __ATOMIC_RELAXED) + (v), __ATOMIC_RELAXED)
+    #define hgdn__counter_store(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+    #define hgdn__atomic_load_ptr(p)  __atomic_load_n((p), __ATOMIC_ACQUIRE)
+    #define hgdn__atomic_store_ptr(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+    #define hgdn__atomic_store_int_relaxed(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+    // Sequentially consistent operations, for handshakes where each side stores one variable and loads the other
+    #define hgdn__atomic_increment_seq_cst(p)  __atomic_add_fetch((p), 1, __ATOMIC_SEQ_CST)
+    #define hgdn__atomic_load_seq_cst(p)  __atomic_load_n((p), __ATOMIC_SEQ_CST)
+    #define hgdn__atomic_exchange_ptr_seq_cst(p, v)  __atomic_exchange_n((p), (v), __ATOMIC_SEQ_CST)
+    #define hgdn__atomic_load_ptr_seq_cst(p)  __atomic_load_n((p), __ATOMIC_SEQ_CST)
+    #define hgdn__yield()  sched_yield()
+#endif
+
+#if defined(__cplusplus) && __cplusplus >= 201103L
+    #define HGDN__THREAD_LOCAL thread_local
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && !defined(__STDC_NO_THREADS__)
+    #define HGDN__THREAD_LOCAL _Thread_local
+#elif defined(_MSC_VER)
+    #define HGDN__THREAD_LOCAL __declspec(thread)
+#else
+    #define HGDN__THREAD_LOCAL __thread
+#endif
 
 const godot_gdnative_core_api_struct *hgdn_core_api;
 #ifndef HGDN_NO_CORE_1_1
@@ -1120,43 +2299,377 @@ const godot_gdnative_ext_net_3_2_api_struct *hgdn_net_3_2_api;
 #endif
 godot_object *hgdn_library;
 godot_method_bind *hgdn_method_Object_callv;
-
-static char hgdn__format_string_buffer[HGDN_STRING_FORMAT_BUFFER_SIZE];
+godot_method_bind *hgdn_method_Object_call;
+godot_method_bind *hgdn_method_Object_get;
+godot_method_bind *hgdn_method_Object_set;
+
+// Each thread formats into its own buffer, so printing never locks.
+// Messages that don't fit are formatted again into a heap buffer of the exact size.
+static HGDN__THREAD_LOCAL char hgdn__format_string_buffer[HGDN_STRING_FORMAT_BUFFER_SIZE];
+static char *hgdn__vformat(godot_int *out_size, const char *fmt, va_list args) {
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int size = vsnprintf(hgdn__format_string_buffer, HGDN_STRING_FORMAT_BUFFER_SIZE, fmt, args_copy);
+    va_end(args_copy);
+    char *buffer = hgdn__format_string_buffer;
+    if (size < 0) {
+        size = 0;
+        buffer[0] = '\0';
+    }
+    else if (size >= HGDN_STRING_FORMAT_BUFFER_SIZE) {
+        char *heap_buffer = (char *) hgdn_alloc_tagged(size + 1, HGDN_MEMORY_TAG_STRING);
+        if (heap_buffer != NULL) {
+            vsnprintf(heap_buffer, size + 1, fmt, args);
+            buffer = heap_buffer;
+        }
+        else {
+            size = HGDN_STRING_FORMAT_BUFFER_SIZE - 1;
+        }
+    }
+    *out_size = size;
+    return buffer;
+}
+static void hgdn__format_release(char *buffer) {
+    if (buffer != hgdn__format_string_buffer) {
+        hgdn_free(buffer);
+    }
+}
 #define HGDN__FILL_FORMAT_BUFFER(fmt, ...) \
     va_list args; \
     va_start(args, fmt); \
-    godot_int size = vsnprintf(hgdn__format_string_buffer, HGDN_STRING_FORMAT_BUFFER_SIZE, fmt, args); \
-    if (size > HGDN_STRING_FORMAT_BUFFER_SIZE) { \
-        size = HGDN_STRING_FORMAT_BUFFER_SIZE; \
-    } \
+    godot_int size; \
+    char *format_buffer = hgdn__vformat(&size, fmt, args); \
     va_end(args)
 
 static godot_array hgdn__empty_array;
 
-// Init and terminate
-void hgdn_gdnative_init(const godot_gdnative_init_options *options) {
-    hgdn_library = options->gd_native_library;
-    hgdn_core_api = options->api_struct;
-    for (const godot_gdnative_api_struct *ext = hgdn_core_api->next; ext; ext = ext->next) {
-#ifndef HGDN_NO_CORE_1_1
-        if (ext->version.major == 1 && ext->version.minor == 1) {
-            hgdn_core_1_1_api = (const godot_gdnative_core_1_1_api_struct *) ext;
-        }
+// Asynchronous logging: bounded MPSC queue where each slot carries a sequence
+// number, so producers claim slots with a single CAS and never block each other
+enum {
+    HGDN__LOG_PRINT,
+    HGDN__LOG_WARNING,
+    HGDN__LOG_ERROR,
+};
+typedef struct hgdn__log_record {
+    int64_t sequence;
+    int type;
+    int line;
+    const char *funcname;
+    const char *filename;
+    char *text;  // either `inline_text` or heap allocated
+    godot_int length;
+    char inline_text[HGDN_LOG_RECORD_TEXT_SIZE];
+} hgdn__log_record;
+typedef struct hgdn__log_ring {
+    int64_t enqueue_pos;
+    char padding[64 - sizeof(int64_t)];  // keep producers' and consumer's positions in separate cache lines
+    int64_t dequeue_pos;
+    int64_t mask;
+    hgdn__log_record *records;
+} hgdn__log_ring;
+static hgdn__log_ring *hgdn__log_ring_ptr;
+static int64_t hgdn__log_producers;  // threads inside `hgdn__log_enqueue`, which may be using the ring
+static hgdn_log_stats hgdn__log_stats;
+static char *hgdn__log_batch;
+static size_t hgdn__log_batch_capacity;
+static godot_bool hgdn__log_enqueue(int type, const char *funcname, const char *filename, int line, const char *text, godot_int length);
+
+// FNV-1a continuing from `hash`, used by `hgdn_cstring_hash` and for keying internal caches by string contents
+static uint32_t hgdn__hash_cstring(uint32_t hash, const char *str) {
+    for ( ; *str; str++) {
+        hash = (hash ^ (uint8_t) *str) * HGDN_STRING_HASH_PRIME;
+    }
+    return hash;
+}
+
+// Method bind cache: open addressing hash table keyed by "classname\0methodname"
+typedef struct hgdn__method_bind_entry {
+    char *key;
+    godot_method_bind *method_bind;
+    uint32_t hash;
+} hgdn__method_bind_entry;
+static hgdn__method_bind_entry *hgdn__method_bind_cache;
+static uint32_t hgdn__method_bind_cache_capacity;
+static uint32_t hgdn__method_bind_cache_size;
+static hgdn__mutex hgdn__method_bind_cache_mutex = HGDN__MUTEX_INITIALIZER;
+static void hgdn__method_bind_cache_clear();
+
+// Interned strings: open addressing hash table keyed by contents, with a
+// direct-mapped cache keyed by pointer in front of it for literals.
+// Lookups are lock-free: entries are published with release stores and
+// never removed, and tables replaced on growth are kept alive until
+// `hgdn__intern_clear`, so readers may still be walking them.
+typedef struct hgdn__intern_entry {
+    hgdn_interned_string *value;
+    uint32_t hash;
+} hgdn__intern_entry;
+typedef struct hgdn__intern_table {
+    struct hgdn__intern_table *retired;
+    hgdn__intern_entry *entries;
+    uint32_t capacity;
+} hgdn__intern_table;
+#define HGDN__INTERN_POINTER_CACHE_SIZE 256
+static hgdn__intern_table *hgdn__intern_table_ptr;
+static uint32_t hgdn__intern_table_size;
+static hgdn_interned_string *hgdn__intern_pointer_cache[HGDN__INTERN_POINTER_CACHE_SIZE];
+static hgdn__mutex hgdn__intern_mutex = HGDN__MUTEX_INITIALIZER;
+static void hgdn__intern_clear();
+
+// Memory statistics: names of user tags are filled on init
+static char hgdn__memory_user_tag_names[HGDN_MEMORY_USER_TAGS][16];
+#ifdef HGDN_MEMORY_STATS
+static void hgdn__memory_clear();
 #endif
-#ifndef HGDN_NO_CORE_1_2
-        if (ext->version.major == 1 && ext->version.minor == 2) {
-            hgdn_core_1_2_api = (const godot_gdnative_core_1_2_api_struct *) ext;
-        }
+
+// NativeScript profiler
+#if defined(HGDN_PROFILE) && !defined(HGDN_NO_EXT_NATIVESCRIPT)
+static int64_t hgdn__profile_base_ns;
+static int64_t hgdn__profile_now_ns();
+static void hgdn__profile_clear();
 #endif
-#ifndef HGDN_NO_CORE_1_3
-        if (ext->version.major == 1 && ext->version.minor == 3) {
-            hgdn_core_1_3_api = (const godot_gdnative_core_1_3_api_struct *) ext;
+
+// Core API call counting: a copy of the real API struct with the entries used by HGDN replaced by counting thunks.
+// X(return type, name, parameters, arguments) for functions returning values, XV for void functions.
+#ifdef HGDN_COUNT_API_CALLS
+#define HGDN__COUNTED_VARIANT_API(X, XV, kind, ctype) \
+    XV(godot_variant_new_##kind, (godot_variant *r_dest, const ctype *p_value), (r_dest, p_value)) \
+    X(ctype, godot_variant_as_##kind, (const godot_variant *p_self), (p_self))
+#define HGDN__COUNTED_POOL_ARRAY_API(X, XV, kind, ctype) \
+    HGDN__COUNTED_VARIANT_API(X, XV, pool_##kind##_array, godot_pool_##kind##_array) \
+    XV(godot_pool_##kind##_array_new, (godot_pool_##kind##_array *r_dest), (r_dest)) \
+    XV(godot_pool_##kind##_array_resize, (godot_pool_##kind##_array *p_self, const godot_int p_size), (p_self, p_size)) \
+    X(godot_int, godot_pool_##kind##_array_size, (const godot_pool_##kind##_array *p_self), (p_self)) \
+    X(godot_pool_##kind##_array_read_access *, godot_pool_##kind##_array_read, (const godot_pool_##kind##_array *p_self), (p_self)) \
+    X(godot_pool_##kind##_array_write_access *, godot_pool_##kind##_array_write, (godot_pool_##kind##_array *p_self), (p_self)) \
+    X(const ctype *, godot_pool_##kind##_array_read_access_ptr, (const godot_pool_##kind##_array_read_access *p_read), (p_read)) \
+    X(ctype *, godot_pool_##kind##_array_write_access_ptr, (const godot_pool_##kind##_array_write_access *p_write), (p_write)) \
+    XV(godot_pool_##kind##_array_read_access_destroy, (godot_pool_##kind##_array_read_access *p_read), (p_read)) \
+    XV(godot_pool_##kind##_array_write_access_destroy, (godot_pool_##kind##_array_write_access *p_write), (p_write)) \
+    XV(godot_pool_##kind##_array_destroy, (godot_pool_##kind##_array *p_self), (p_self))
+#define HGDN__COUNTED_API(X, XV) \
+    X(godot_method_bind *, godot_method_bind_get_method, (const char *p_classname, const char *p_methodname), (p_classname, p_methodname)) \
+    XV(godot_method_bind_ptrcall, (godot_method_bind *p_method_bind, godot_object *p_instance, const void **p_args, void *p_ret), (p_method_bind, p_instance, p_args, p_ret)) \
+    X(godot_variant, godot_method_bind_call, (godot_method_bind *p_method_bind, godot_object *p_instance, const godot_variant **p_args, const int p_arg_count, godot_variant_call_error *p_call_error), (p_method_bind, p_instance, p_args, p_arg_count, p_call_error)) \
+    X(godot_class_constructor, godot_get_class_constructor, (const char *p_classname), (p_classname)) \
+    X(godot_object *, godot_global_get_singleton, (char *p_name), (p_name)) \
+    X(void *, godot_alloc, (int p_bytes), (p_bytes)) \
+    X(void *, godot_realloc, (void *p_ptr, int p_bytes), (p_ptr, p_bytes)) \
+    XV(godot_free, (void *p_ptr), (p_ptr)) \
+    XV(godot_print_error, (const char *p_description, const char *p_function, const char *p_file, int p_line), (p_description, p_function, p_file, p_line)) \
+    XV(godot_print_warning, (const char *p_description, const char *p_function, const char *p_file, int p_line), (p_description, p_function, p_file, p_line)) \
+    XV(godot_print, (const godot_string *p_message), (p_message)) \
+    XV(godot_string_new, (godot_string *r_dest), (r_dest)) \
+    XV(godot_string_new_copy, (godot_string *r_dest, const godot_string *p_src), (r_dest, p_src)) \
+    XV(godot_string_new_with_wide_string, (godot_string *r_dest, const wchar_t *p_contents, const int p_size), (r_dest, p_contents, p_size)) \
+    X(const wchar_t *, godot_string_wide_str, (const godot_string *p_self), (p_self)) \
+    X(godot_int, godot_string_length, (const godot_string *p_self), (p_self)) \
+    X(godot_char_string, godot_string_utf8, (const godot_string *p_self), (p_self)) \
+    X(godot_string, godot_string_chars_to_utf8, (const char *p_utf8), (p_utf8)) \
+    X(godot_string, godot_string_chars_to_utf8_with_len, (const char *p_utf8, godot_int p_len), (p_utf8, p_len)) \
+    X(uint32_t, godot_string_hash, (const godot_string *p_self), (p_self)) \
+    X(godot_bool, godot_string_operator_equal, (const godot_string *p_self, const godot_string *p_b), (p_self, p_b)) \
+    XV(godot_string_destroy, (godot_string *p_self), (p_self)) \
+    X(godot_int, godot_char_string_length, (const godot_char_string *p_cs), (p_cs)) \
+    X(const char *, godot_char_string_get_data, (const godot_char_string *p_cs), (p_cs)) \
+    XV(godot_char_string_destroy, (godot_char_string *p_cs), (p_cs)) \
+    XV(godot_string_name_new, (godot_string_name *r_dest, const godot_string *p_name), (r_dest, p_name)) \
+    XV(godot_string_name_destroy, (godot_string_name *p_self), (p_self)) \
+    X(godot_variant_type, godot_variant_get_type, (const godot_variant *p_v), (p_v)) \
+    XV(godot_variant_new_copy, (godot_variant *r_dest, const godot_variant *p_src), (r_dest, p_src)) \
+    XV(godot_variant_new_nil, (godot_variant *r_dest), (r_dest)) \
+    XV(godot_variant_new_bool, (godot_variant *r_dest, const godot_bool p_b), (r_dest, p_b)) \
+    XV(godot_variant_new_uint, (godot_variant *r_dest, const uint64_t p_i), (r_dest, p_i)) \
+    XV(godot_variant_new_int, (godot_variant *r_dest, const int64_t p_i), (r_dest, p_i)) \
+    XV(godot_variant_new_real, (godot_variant *r_dest, const double p_r), (r_dest, p_r)) \
+    XV(godot_variant_new_object, (godot_variant *r_dest, const godot_object *p_obj), (r_dest, p_obj)) \
+    X(godot_bool, godot_variant_as_bool, (const godot_variant *p_self), (p_self)) \
+    X(uint64_t, godot_variant_as_uint, (const godot_variant *p_self), (p_self)) \
+    X(int64_t, godot_variant_as_int, (const godot_variant *p_self), (p_self)) \
+    X(double, godot_variant_as_real, (const godot_variant *p_self), (p_self)) \
+    X(godot_object *, godot_variant_as_object, (const godot_variant *p_self), (p_self)) \
+    X(godot_bool, godot_variant_operator_equal, (const godot_variant *p_self, const godot_variant *p_other), (p_self, p_other)) \
+    XV(godot_variant_destroy, (godot_variant *p_self), (p_self)) \
+    HGDN__COUNTED_VARIANT_API(X, XV, string, godot_string) \
+    HGDN__COUNTED_VARIANT_API(X, XV, vector2, godot_vector2) \
+    HGDN__COUNTED_VARIANT_API(X, XV, rect2, godot_rect2) \
+    HGDN__COUNTED_VARIANT_API(X, XV, vector3, godot_vector3) \
+    HGDN__COUNTED_VARIANT_API(X, XV, transform2d, godot_transform2d) \
+    HGDN__COUNTED_VARIANT_API(X, XV, plane, godot_plane) \
+    HGDN__COUNTED_VARIANT_API(X, XV, quat, godot_quat) \
+    HGDN__COUNTED_VARIANT_API(X, XV, aabb, godot_aabb) \
+    HGDN__COUNTED_VARIANT_API(X, XV, basis, godot_basis) \
+    HGDN__COUNTED_VARIANT_API(X, XV, transform, godot_transform) \
+    HGDN__COUNTED_VARIANT_API(X, XV, color, godot_color) \
+    HGDN__COUNTED_VARIANT_API(X, XV, node_path, godot_node_path) \
+    HGDN__COUNTED_VARIANT_API(X, XV, rid, godot_rid) \
+    HGDN__COUNTED_VARIANT_API(X, XV, dictionary, godot_dictionary) \
+    HGDN__COUNTED_VARIANT_API(X, XV, array, godot_array) \
+    XV(godot_array_new, (godot_array *r_dest), (r_dest)) \
+    XV(godot_array_set, (godot_array *p_self, const godot_int p_idx, const godot_variant *p_value), (p_self, p_idx, p_value)) \
+    X(godot_variant, godot_array_get, (const godot_array *p_self, const godot_int p_idx), (p_self, p_idx)) \
+    X(godot_variant *, godot_array_operator_index, (godot_array *p_self, const godot_int p_idx), (p_self, p_idx)) \
+    X(const godot_variant *, godot_array_operator_index_const, (const godot_array *p_self, const godot_int p_idx), (p_self, p_idx)) \
+    XV(godot_array_append, (godot_array *p_self, const godot_variant *p_value), (p_self, p_value)) \
+    XV(godot_array_resize, (godot_array *p_self, const godot_int p_size), (p_self, p_size)) \
+    X(godot_int, godot_array_size, (const godot_array *p_self), (p_self)) \
+    XV(godot_array_destroy, (godot_array *p_self), (p_self)) \
+    XV(godot_dictionary_new, (godot_dictionary *r_dest), (r_dest)) \
+    X(godot_int, godot_dictionary_size, (const godot_dictionary *p_self), (p_self)) \
+    X(godot_bool, godot_dictionary_has, (const godot_dictionary *p_self, const godot_variant *p_key), (p_self, p_key)) \
+    X(godot_variant, godot_dictionary_get, (const godot_dictionary *p_self, const godot_variant *p_key), (p_self, p_key)) \
+    XV(godot_dictionary_set, (godot_dictionary *p_self, const godot_variant *p_key, const godot_variant *p_value), (p_self, p_key, p_value)) \
+    X(godot_variant *, godot_dictionary_operator_index, (godot_dictionary *p_self, const godot_variant *p_key), (p_self, p_key)) \
+    X(const godot_variant *, godot_dictionary_operator_index_const, (const godot_dictionary *p_self, const godot_variant *p_key), (p_self, p_key)) \
+    X(godot_variant *, godot_dictionary_next, (const godot_dictionary *p_self, const godot_variant *p_key), (p_self, p_key)) \
+    XV(godot_dictionary_destroy, (godot_dictionary *p_self), (p_self)) \
+    XV(godot_node_path_destroy, (godot_node_path *p_self), (p_self)) \
+    XV(godot_pool_string_array_set, (godot_pool_string_array *p_self, const godot_int p_idx, const godot_string *p_data), (p_self, p_idx, p_data)) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, byte, uint8_t) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, int, godot_int) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, real, godot_real) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, string, godot_string) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, vector2, godot_vector2) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, vector3, godot_vector3) \
+    HGDN__COUNTED_POOL_ARRAY_API(X, XV, color, godot_color)
+
+#define HGDN__API_INDEX(ret, name, params, args)  HGDN__API_##name,
+#define HGDN__API_INDEX_VOID(name, params, args)  HGDN__API_##name,
+enum { HGDN__COUNTED_API(HGDN__API_INDEX, HGDN__API_INDEX_VOID) HGDN__API_COUNT };
+#undef HGDN__API_INDEX
+#undef HGDN__API_INDEX_VOID
+
+#define HGDN__API_NAME(ret, name, params, args)  #name,
+#define HGDN__API_NAME_VOID(name, params, args)  #name,
+static const char *const hgdn__api_call_names[] = { HGDN__COUNTED_API(HGDN__API_NAME, HGDN__API_NAME_VOID) };
+#undef HGDN__API_NAME
+#undef HGDN__API_NAME_VOID
+
+static int64_t hgdn__api_call_counts[HGDN__API_COUNT];
+static const godot_gdnative_core_api_struct *hgdn__api_calls_real;
+static godot_gdnative_core_api_struct hgdn__api_calls_proxy;
+
+#define HGDN__API_THUNK(ret, name, params, args) \
+    static ret hgdn__counted_##name params { \
+        hgdn__atomic_increment(&hgdn__api_call_counts[HGDN__API_##name]); \
+        return hgdn__api_calls_real->name args; \
+    }
+#define HGDN__API_THUNK_VOID(name, params, args) \
+    static void hgdn__counted_##name params { \
+        hgdn__atomic_increment(&hgdn__api_call_counts[HGDN__API_##name]); \
+        hgdn__api_calls_real->name args; \
+    }
+HGDN__COUNTED_API(HGDN__API_THUNK, HGDN__API_THUNK_VOID)
+#undef HGDN__API_THUNK
+#undef HGDN__API_THUNK_VOID
+
+static const godot_gdnative_core_api_struct *hgdn__api_calls_install(const godot_gdnative_core_api_struct *api) {
+    hgdn__api_calls_real = api;
+    hgdn__api_calls_proxy = *api;
+#define HGDN__API_INSTALL(ret, name, params, args)  hgdn__api_calls_proxy.name = &hgdn__counted_##name;
+#define HGDN__API_INSTALL_VOID(name, params, args)  hgdn__api_calls_proxy.name = &hgdn__counted_##name;
+    HGDN__COUNTED_API(HGDN__API_INSTALL, HGDN__API_INSTALL_VOID)
+#undef HGDN__API_INSTALL
+#undef HGDN__API_INSTALL_VOID
+    return &hgdn__api_calls_proxy;
+}
+#undef HGDN__COUNTED_API
+#undef HGDN__COUNTED_POOL_ARRAY_API
+#undef HGDN__COUNTED_VARIANT_API
+#endif
+
+int64_t hgdn_api_calls_get_total() {
+    int64_t total = 0;
+#ifdef HGDN_COUNT_API_CALLS
+    for (int i = 0; i < HGDN__API_COUNT; i++) {
+        total += hgdn__atomic_load(&hgdn__api_call_counts[i]);
+    }
+#endif
+    return total;
+}
+
+godot_int hgdn_api_calls_get_top(hgdn_api_call_count *buffer, const godot_int size) {
+    godot_int count = 0;
+#ifdef HGDN_COUNT_API_CALLS
+    for (int i = 0; i < HGDN__API_COUNT && size > 0; i++) {
+        int64_t calls = hgdn__atomic_load(&hgdn__api_call_counts[i]);
+        if (calls == 0 || (count == size && calls <= buffer[size - 1].calls)) {
+            continue;
         }
+        // insertion sort, dropping the last entry when the buffer is full
+        godot_int j = count < size ? count++ : size - 1;
+        for ( ; j > 0 && buffer[j - 1].calls < calls; j--) {
+            buffer[j] = buffer[j - 1];
+        }
+        buffer[j].name = hgdn__api_call_names[i];
+        buffer[j].calls = calls;
+    }
 #endif
+    return count;
+}
+
+void hgdn_api_calls_reset() {
+#ifdef HGDN_COUNT_API_CALLS
+    for (int i = 0; i < HGDN__API_COUNT; i++) {
+        hgdn__atomic_store(&hgdn__api_call_counts[i], 0);
     }
+#endif
+}
 
-    for (unsigned int i = 0; i < hgdn_core_api->num_extensions; i++) {
-        switch(hgdn_core_api->extensions[i]->type) {
+void hgdn_api_calls_print_report(const godot_int count) {
+    int64_t total = hgdn_api_calls_get_total();
+    hgdn_api_call_count *buffer = count > 0 ? (hgdn_api_call_count *) hgdn_alloc(count * sizeof(hgdn_api_call_count)) : NULL;
+    godot_int size = buffer ? hgdn_api_calls_get_top(buffer, count) : 0;
+    hgdn_print("Core API calls: %lld", (long long) total);
+    for (godot_int i = 0; i < size; i++) {
+        hgdn_print("  %-48s %12lld  %5.1f%%", buffer[i].name, (long long) buffer[i].calls, 100.0 * buffer[i].calls / total);
+    }
+    hgdn_free(buffer);
+}
+
+godot_dictionary hgdn_api_calls_to_dictionary() {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+#ifdef HGDN_COUNT_API_CALLS
+    for (int i = 0; i < HGDN__API_COUNT; i++) {
+        int64_t calls = hgdn__atomic_load(&hgdn__api_call_counts[i]);
+        if (calls > 0) {
+            godot_variant key = hgdn_new_cstring_variant(hgdn__api_call_names[i]);
+            godot_variant value = hgdn_new_int_variant(calls);
+            hgdn_core_api->godot_dictionary_set(&dict, &key, &value);
+            hgdn_core_api->godot_variant_destroy(&key);
+        }
+    }
+#endif
+    return dict;
+}
+
+// Init and terminate
+void hgdn_gdnative_init(const godot_gdnative_init_options *options) {
+    hgdn_library = options->gd_native_library;
+    hgdn_core_api = options->api_struct;
+#ifdef HGDN_COUNT_API_CALLS
+    hgdn_core_api = hgdn__api_calls_install(hgdn_core_api);
+#endif
+    for (const godot_gdnative_api_struct *ext = hgdn_core_api->next; ext; ext = ext->next) {
+#ifndef HGDN_NO_CORE_1_1
+        if (ext->version.major == 1 && ext->version.minor == 1) {
+            hgdn_core_1_1_api = (const godot_gdnative_core_1_1_api_struct *) ext;
+        }
+#endif
+#ifndef HGDN_NO_CORE_1_2
+        if (ext->version.major == 1 && ext->version.minor == 2) {
+            hgdn_core_1_2_api = (const godot_gdnative_core_1_2_api_struct *) ext;
+        }
+#endif
+#ifndef HGDN_NO_CORE_1_3
+        if (ext->version.major == 1 && ext->version.minor == 3) {
+            hgdn_core_1_3_api = (const godot_gdnative_core_1_3_api_struct *) ext;
+        }
+#endif
+    }
+
+    for (unsigned int i = 0; i < hgdn_core_api->num_extensions; i++) {
+        switch(hgdn_core_api->extensions[i]->type) {
 #ifndef HGDN_NO_EXT_NATIVESCRIPT
             case GDNATIVE_EXT_NATIVESCRIPT:
                 hgdn_nativescript_api = (const godot_gdnative_ext_nativescript_api_struct *) hgdn_core_api->extensions[i];
@@ -1208,46 +2721,847 @@ void hgdn_gdnative_init(const godot_gdnative_init_options *options) {
     }
 
     hgdn_method_Object_callv = hgdn_core_api->godot_method_bind_get_method("Object", "callv");
+    hgdn_method_Object_call = hgdn_core_api->godot_method_bind_get_method("Object", "call");
+    hgdn_method_Object_get = hgdn_core_api->godot_method_bind_get_method("Object", "get");
+    hgdn_method_Object_set = hgdn_core_api->godot_method_bind_get_method("Object", "set");
     hgdn_core_api->godot_array_new(&hgdn__empty_array);
+#if defined(HGDN_PROFILE) && !defined(HGDN_NO_EXT_NATIVESCRIPT)
+    hgdn__profile_base_ns = hgdn__profile_now_ns();
+#endif
+    for (int i = 0; i < HGDN_MEMORY_USER_TAGS; i++) {
+        snprintf(hgdn__memory_user_tag_names[i], sizeof(hgdn__memory_user_tag_names[i]), "user%d", i);
+    }
 }
 
 void hgdn_gdnative_terminate(const godot_gdnative_terminate_options *options) {
+    hgdn_log_async_stop();
+    hgdn__method_bind_cache_clear();
+    hgdn__intern_clear();
+    hgdn_arena_destroy(hgdn_scratch_arena());
     hgdn_core_api->godot_array_destroy(&hgdn__empty_array);
+#if defined(HGDN_PROFILE) && !defined(HGDN_NO_EXT_NATIVESCRIPT)
+    hgdn__profile_clear();
+#endif
+#ifdef HGDN_MEMORY_STATS
+    hgdn__memory_clear();
+#endif
 }
 
 // Memory API
+#ifdef HGDN_MEMORY_STATS
+// 16 bytes, so that allocations keep the alignment given by `godot_alloc`
+typedef struct hgdn__memory_header {
+    int64_t size;
+    int64_t tag;
+} hgdn__memory_header;
+
+// Counters written only by its owner thread, merged when stats are read
+typedef struct hgdn__memory_thread_stats {
+    struct hgdn__memory_thread_stats *next;
+    struct {
+        int64_t allocations;
+        int64_t frees;
+        int64_t allocated_bytes;
+        int64_t size_classes[HGDN_MEMORY_SIZE_CLASSES];
+    } tags[HGDN_MEMORY_TAG_COUNT];
+} hgdn__memory_thread_stats;
+
+// Live and peak bytes need a global view, so they are shared atomics
+static int64_t hgdn__memory_live_bytes[HGDN_MEMORY_TAG_COUNT];
+static int64_t hgdn__memory_peak_bytes[HGDN_MEMORY_TAG_COUNT];
+static hgdn__mutex hgdn__memory_mutex = HGDN__MUTEX_INITIALIZER;
+static hgdn__memory_thread_stats *hgdn__memory_threads;
+static int64_t hgdn__memory_generation;
+static HGDN__THREAD_LOCAL hgdn__memory_thread_stats *hgdn__memory_thread;
+static HGDN__THREAD_LOCAL int64_t hgdn__memory_thread_generation;
+
+static hgdn__memory_thread_stats *hgdn__memory_get_thread_stats() {
+    int64_t generation = hgdn__atomic_load(&hgdn__memory_generation);
+    if (hgdn__memory_thread == NULL || hgdn__memory_thread_generation != generation) {
+        hgdn__memory_thread_stats *stats = (hgdn__memory_thread_stats *) hgdn_core_api->godot_alloc(sizeof(hgdn__memory_thread_stats));
+        if (stats == NULL) {
+            return NULL;
+        }
+        memset(stats, 0, sizeof(hgdn__memory_thread_stats));
+        hgdn__mutex_lock(&hgdn__memory_mutex);
+        stats->next = hgdn__memory_threads;
+        hgdn__memory_threads = stats;
+        hgdn__memory_thread_generation = hgdn__memory_generation;
+        hgdn__mutex_unlock(&hgdn__memory_mutex);
+        hgdn__memory_thread = stats;
+    }
+    return hgdn__memory_thread;
+}
+
+static void hgdn__memory_clear() {
+    hgdn__mutex_lock(&hgdn__memory_mutex);
+    hgdn__memory_thread_stats *stats = hgdn__memory_threads;
+    while (stats) {
+        hgdn__memory_thread_stats *next = stats->next;
+        hgdn_core_api->godot_free(stats);
+        stats = next;
+    }
+    hgdn__memory_threads = NULL;
+    hgdn__atomic_store(&hgdn__memory_generation, hgdn__memory_generation + 1);
+    hgdn__mutex_unlock(&hgdn__memory_mutex);
+}
+
+static int hgdn__memory_size_class(int64_t size) {
+    int size_class = 0;
+    int64_t limit = 16;
+    while (size > limit && size_class < HGDN_MEMORY_SIZE_CLASSES - 1) {
+        limit <<= 1;
+        size_class++;
+    }
+    return size_class;
+}
+
+static void hgdn__memory_account_alloc(int64_t size, int tag) {
+    int64_t live = hgdn__atomic_add(&hgdn__memory_live_bytes[tag], size);
+    int64_t peak = hgdn__atomic_load(&hgdn__memory_peak_bytes[tag]);
+    while (live > peak && !hgdn__atomic_cas(&hgdn__memory_peak_bytes[tag], peak, live)) {
+        peak = hgdn__atomic_load(&hgdn__memory_peak_bytes[tag]);
+    }
+    hgdn__memory_thread_stats *stats = hgdn__memory_get_thread_stats();
+    if (stats) {
+        hgdn__counter_add(&stats->tags[tag].allocations, 1);
+        hgdn__counter_add(&stats->tags[tag].allocated_bytes, size);
+        hgdn__counter_add(&stats->tags[tag].size_classes[hgdn__memory_size_class(size)], 1);
+    }
+}
+
+static void hgdn__memory_account_free(int64_t size, int tag) {
+    hgdn__atomic_add(&hgdn__memory_live_bytes[tag], -size);
+    hgdn__memory_thread_stats *stats = hgdn__memory_get_thread_stats();
+    if (stats) {
+        hgdn__counter_add(&stats->tags[tag].frees, 1);
+    }
+}
+#endif
+
 void *hgdn_alloc(size_t size) {
-    return hgdn_core_api->godot_alloc(size);
+    return hgdn_alloc_tagged(size, HGDN_MEMORY_TAG_DEFAULT);
 }
 
 void *hgdn_realloc(void *ptr, size_t size) {
-    return hgdn_core_api->godot_realloc(ptr, size);
+#ifdef HGDN_MEMORY_STATS
+    if (ptr) {
+        return hgdn_realloc_tagged(ptr, size, (hgdn_memory_tag) ((hgdn__memory_header *) ptr - 1)->tag);
+    }
+#endif
+    return hgdn_realloc_tagged(ptr, size, HGDN_MEMORY_TAG_DEFAULT);
 }
 
 void hgdn_free(void *ptr) {
     if (ptr) {
+#ifdef HGDN_MEMORY_STATS
+        hgdn__memory_header *header = (hgdn__memory_header *) ptr - 1;
+        hgdn__memory_account_free(header->size, (int) header->tag);
+        ptr = header;
+#endif
         hgdn_core_api->godot_free(ptr);
     }
 }
 
+void *hgdn_alloc_tagged(size_t size, hgdn_memory_tag tag) {
+#ifdef HGDN_MEMORY_STATS
+    if (tag < 0 || tag >= HGDN_MEMORY_TAG_COUNT) {
+        tag = HGDN_MEMORY_TAG_DEFAULT;
+    }
+    hgdn__memory_header *header = (hgdn__memory_header *) hgdn_core_api->godot_alloc(sizeof(hgdn__memory_header) + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    header->size = size;
+    header->tag = tag;
+    hgdn__memory_account_alloc(size, tag);
+    return header + 1;
+#else
+    return hgdn_core_api->godot_alloc(size);
+#endif
+}
+
+void *hgdn_realloc_tagged(void *ptr, size_t size, hgdn_memory_tag tag) {
+#ifdef HGDN_MEMORY_STATS
+    if (ptr == NULL) {
+        return hgdn_alloc_tagged(size, tag);
+    }
+    if (tag < 0 || tag >= HGDN_MEMORY_TAG_COUNT) {
+        tag = HGDN_MEMORY_TAG_DEFAULT;
+    }
+    hgdn__memory_header *header = (hgdn__memory_header *) ptr - 1;
+    int64_t old_size = header->size;
+    int old_tag = (int) header->tag;
+    header = (hgdn__memory_header *) hgdn_core_api->godot_realloc(header, sizeof(hgdn__memory_header) + size);
+    if (header == NULL) {
+        return NULL;
+    }
+    hgdn__memory_account_free(old_size, old_tag);
+    header->size = size;
+    header->tag = tag;
+    hgdn__memory_account_alloc(size, tag);
+    return header + 1;
+#else
+    return hgdn_core_api->godot_realloc(ptr, size);
+#endif
+}
+
+static const char *const hgdn__memory_tag_names[] = {
+    "default", "string", "arena", "instance", "log", "cache",
+};
+
+hgdn_memory_stats hgdn_memory_get_stats() {
+    hgdn_memory_stats stats;
+    memset(&stats, 0, sizeof(hgdn_memory_stats));
+#ifdef HGDN_MEMORY_STATS
+    hgdn__mutex_lock(&hgdn__memory_mutex);
+    for (int i = 0; i < HGDN_MEMORY_TAG_COUNT; i++) {
+        hgdn_memory_tag_stats *tag = &stats.tags[i];
+        tag->live_bytes = hgdn__atomic_load(&hgdn__memory_live_bytes[i]);
+        tag->peak_bytes = hgdn__atomic_load(&hgdn__memory_peak_bytes[i]);
+        for (hgdn__memory_thread_stats *thread = hgdn__memory_threads; thread; thread = thread->next) {
+            tag->allocations += hgdn__atomic_load(&thread->tags[i].allocations);
+            tag->frees += hgdn__atomic_load(&thread->tags[i].frees);
+            tag->allocated_bytes += hgdn__atomic_load(&thread->tags[i].allocated_bytes);
+            for (int j = 0; j < HGDN_MEMORY_SIZE_CLASSES; j++) {
+                tag->size_classes[j] += hgdn__atomic_load(&thread->tags[i].size_classes[j]);
+            }
+        }
+    }
+    hgdn__mutex_unlock(&hgdn__memory_mutex);
+#endif
+    return stats;
+}
+
+const char *hgdn_memory_tag_name(hgdn_memory_tag tag) {
+    if (tag >= 0 && tag < HGDN_MEMORY_TAG_USER) {
+        return hgdn__memory_tag_names[tag];
+    }
+    else if (tag >= HGDN_MEMORY_TAG_USER && tag < HGDN_MEMORY_TAG_COUNT) {
+        return hgdn__memory_user_tag_names[tag - HGDN_MEMORY_TAG_USER];
+    }
+    else {
+        return NULL;
+    }
+}
+
+godot_dictionary hgdn_memory_stats_to_dictionary(const hgdn_memory_stats *stats) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (int i = 0; i < HGDN_MEMORY_TAG_COUNT; i++) {
+        const hgdn_memory_tag_stats *tag = &stats->tags[i];
+        godot_variant size_classes[HGDN_MEMORY_SIZE_CLASSES];
+        for (int j = 0; j < HGDN_MEMORY_SIZE_CLASSES; j++) {
+            size_classes[j] = hgdn_new_int_variant(tag->size_classes[j]);
+        }
+        hgdn_dictionary_entry_string_own entries[] = {
+            { "live_bytes", hgdn_new_int_variant(tag->live_bytes) },
+            { "peak_bytes", hgdn_new_int_variant(tag->peak_bytes) },
+            { "allocations", hgdn_new_int_variant(tag->allocations) },
+            { "frees", hgdn_new_int_variant(tag->frees) },
+            { "allocated_bytes", hgdn_new_int_variant(tag->allocated_bytes) },
+            { "size_classes", hgdn_new_array_variant_own(hgdn_new_array_own(size_classes, HGDN_MEMORY_SIZE_CLASSES)) },
+        };
+        godot_variant key = hgdn_new_cstring_variant(hgdn_memory_tag_name((hgdn_memory_tag) i));
+        godot_variant value = hgdn_new_dictionary_variant_own(hgdn_new_dictionary_string_own(entries, sizeof(entries) / sizeof(entries[0])));
+        hgdn_core_api->godot_dictionary_set(&dict, &key, &value);
+        hgdn_core_api->godot_variant_destroy(&key);
+        hgdn_core_api->godot_variant_destroy(&value);
+    }
+    return dict;
+}
+
+godot_variant hgdn_memory_stats_native_call(godot_array *args) {
+    hgdn_memory_stats stats = hgdn_memory_get_stats();
+    return hgdn_new_dictionary_variant_own(hgdn_memory_stats_to_dictionary(&stats));
+}
+
+godot_variant hgdn_memory_stats_method(godot_object *instance, void *method_data, void *data, int argc, godot_variant **args) {
+    hgdn_memory_stats stats = hgdn_memory_get_stats();
+    return hgdn_new_dictionary_variant_own(hgdn_memory_stats_to_dictionary(&stats));
+}
+
+// Arena allocator
+#define HGDN__ARENA_ALIGNMENT 16
+
+struct hgdn_arena_block {
+    hgdn_arena_block *next;
+    size_t size;
+    size_t used;
+};
+
+static HGDN__THREAD_LOCAL hgdn_arena hgdn__scratch_arena;
+
+hgdn_arena hgdn_new_arena(size_t block_size) {
+    hgdn_arena arena = { NULL, NULL, block_size };
+    return arena;
+}
+
+// Blocks after `current` are always considered empty, their `used` is reset when `current` moves into them
+void *hgdn_arena_alloc(hgdn_arena *arena, size_t size) {
+    hgdn_arena_block *block = arena->current;
+    while (block) {
+        uintptr_t data = (uintptr_t) (block + 1);
+        uintptr_t start = (data + block->used + HGDN__ARENA_ALIGNMENT - 1) & ~((uintptr_t) HGDN__ARENA_ALIGNMENT - 1);
+        uintptr_t end = data + block->size;
+        // Compared as a remaining size, so `start + size` can't wrap around
+        if (start <= end && size <= end - start) {
+            block->used = start + size - data;
+            arena->current = block;
+            return (void *) start;
+        }
+        if (block->next == NULL) {
+            break;
+        }
+        block = block->next;
+        block->used = 0;
+    }
+
+    if (size > SIZE_MAX - sizeof(hgdn_arena_block) - (HGDN__ARENA_ALIGNMENT - 1)) {
+        return NULL;
+    }
+    size_t block_size = arena->block_size ? arena->block_size : HGDN_ARENA_BLOCK_SIZE;
+    if (block_size < size + HGDN__ARENA_ALIGNMENT - 1) {
+        block_size = size + HGDN__ARENA_ALIGNMENT - 1;
+    }
+    if (block_size > SIZE_MAX - sizeof(hgdn_arena_block)) {
+        return NULL;
+    }
+    hgdn_arena_block *new_block = (hgdn_arena_block *) hgdn_alloc_tagged(sizeof(hgdn_arena_block) + block_size, HGDN_MEMORY_TAG_ARENA);
+    if (new_block == NULL) {
+        return NULL;
+    }
+    new_block->next = NULL;
+    new_block->size = block_size;
+    new_block->used = 0;
+    if (block) {
+        block->next = new_block;
+    }
+    else {
+        arena->first = new_block;
+    }
+    arena->current = new_block;
+    return hgdn_arena_alloc(arena, size);
+}
+
+void *hgdn_arena_calloc(hgdn_arena *arena, size_t count, size_t size) {
+    if (size && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = hgdn_arena_alloc(arena, count * size);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+hgdn_arena_mark hgdn_arena_get_mark(const hgdn_arena *arena) {
+    hgdn_arena_mark mark = { arena->current, arena->current ? arena->current->used : 0 };
+    return mark;
+}
+
+void hgdn_arena_reset_to_mark(hgdn_arena *arena, hgdn_arena_mark mark) {
+    if (mark.block) {
+        arena->current = mark.block;
+        mark.block->used = mark.used;
+    }
+    else {
+        hgdn_arena_reset(arena);
+    }
+}
+
+void hgdn_arena_reset(hgdn_arena *arena) {
+    arena->current = arena->first;
+    if (arena->first) {
+        arena->first->used = 0;
+    }
+}
+
+void hgdn_arena_destroy(hgdn_arena *arena) {
+    hgdn_arena_block *block = arena->first;
+    while (block) {
+        hgdn_arena_block *next = block->next;
+        hgdn_free(block);
+        block = next;
+    }
+    arena->first = arena->current = NULL;
+}
+
+hgdn_arena *hgdn_scratch_arena() {
+    return &hgdn__scratch_arena;
+}
+
+void hgdn_frame_arena_reset() {
+    hgdn_arena_reset(&hgdn__scratch_arena);
+}
+
+#undef HGDN__ARENA_ALIGNMENT
+
 // Print functions
+int hgdn_log_level = HGDN_LOG_LEVEL;
+
+void hgdn_log_set_level(int level) {
+    hgdn__atomic_store_int_relaxed(&hgdn_log_level, level > HGDN_LOG_LEVEL ? level : HGDN_LOG_LEVEL);
+}
+
 void hgdn_print(const char *fmt, ...) {
     HGDN__FILL_FORMAT_BUFFER(fmt, ...);
-    godot_string str = hgdn_new_string_with_len(hgdn__format_string_buffer, size);
+    if (hgdn__log_enqueue(HGDN__LOG_PRINT, NULL, NULL, 0, format_buffer, size)) {
+        hgdn__format_release(format_buffer);
+        return;
+    }
+    godot_string str = hgdn_new_string_with_len(format_buffer, size);
+    hgdn__format_release(format_buffer);
     hgdn_core_api->godot_print(&str);
     hgdn_core_api->godot_string_destroy(&str);
 }
 
 void hgdn_print_warning(const char *funcname, const char *filename, int line, const char *fmt, ...) {
     HGDN__FILL_FORMAT_BUFFER(fmt, ...);
-    hgdn_core_api->godot_print_warning(hgdn__format_string_buffer, funcname, filename, line);
+    if (!hgdn__log_enqueue(HGDN__LOG_WARNING, funcname, filename, line, format_buffer, size)) {
+        hgdn_core_api->godot_print_warning(format_buffer, funcname, filename, line);
+    }
+    hgdn__format_release(format_buffer);
 }
 
 void hgdn_print_error(const char *funcname, const char *filename, int line, const char *fmt, ...) {
     HGDN__FILL_FORMAT_BUFFER(fmt, ...);
-    hgdn_core_api->godot_print_error(hgdn__format_string_buffer, funcname, filename, line);
+    if (!hgdn__log_enqueue(HGDN__LOG_ERROR, funcname, filename, line, format_buffer, size)) {
+        hgdn_core_api->godot_print_error(format_buffer, funcname, filename, line);
+    }
+    hgdn__format_release(format_buffer);
+}
+
+// Asynchronous logging
+godot_bool hgdn_log_async_start(godot_int capacity) {
+    if (hgdn__atomic_load_ptr(&hgdn__log_ring_ptr) != NULL) {
+        return 1;
+    }
+    int64_t size = 1;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    hgdn__log_ring *ring = (hgdn__log_ring *) hgdn_alloc_tagged(sizeof(hgdn__log_ring) + size * sizeof(hgdn__log_record), HGDN_MEMORY_TAG_LOG);
+    if (ring == NULL) {
+        return 0;
+    }
+    ring->enqueue_pos = 0;
+    ring->dequeue_pos = 0;
+    ring->mask = size - 1;
+    ring->records = (hgdn__log_record *) (ring + 1);
+    for (int64_t i = 0; i < size; i++) {
+        ring->records[i].sequence = i;
+    }
+    hgdn__atomic_store_ptr(&hgdn__log_ring_ptr, ring);
+    return 1;
+}
+
+static godot_int hgdn__log_flush_ring(hgdn__log_ring *ring);
+
+void hgdn_log_async_stop() {
+    hgdn__log_ring *ring = (hgdn__log_ring *) hgdn__atomic_load_ptr(&hgdn__log_ring_ptr);
+    if (ring == NULL) {
+        return;
+    }
+    // New messages are printed directly from now on. Producers that already got the ring
+    // finish publishing their records before it is flushed for the last time and freed.
+    (void) hgdn__atomic_exchange_ptr_seq_cst(&hgdn__log_ring_ptr, (hgdn__log_ring *) NULL);
+    while (hgdn__atomic_load_seq_cst(&hgdn__log_producers) != 0) {
+        hgdn__yield();
+    }
+    hgdn__log_flush_ring(ring);
+    hgdn_free(ring);
+    hgdn_free(hgdn__log_batch);
+    hgdn__log_batch = NULL;
+    hgdn__log_batch_capacity = 0;
+}
+
+static void hgdn__log_ring_push(hgdn__log_ring *ring, int type, const char *funcname, const char *filename, int line, const char *text, godot_int length) {
+    hgdn__log_record *record;
+    int64_t pos = hgdn__atomic_load(&ring->enqueue_pos);
+    for (;;) {
+        record = &ring->records[pos & ring->mask];
+        int64_t diff = hgdn__atomic_load(&record->sequence) - pos;
+        if (diff == 0) {
+            if (hgdn__atomic_cas(&ring->enqueue_pos, pos, pos + 1)) {
+                break;
+            }
+        }
+        else if (diff < 0) {
+            hgdn__atomic_increment(&hgdn__log_stats.dropped);
+            return;
+        }
+        pos = hgdn__atomic_load(&ring->enqueue_pos);
+    }
+    record->type = type;
+    record->line = line;
+    record->funcname = funcname;
+    record->filename = filename;
+    record->length = length;
+    record->text = length < HGDN_LOG_RECORD_TEXT_SIZE ? NULL : (char *) hgdn_alloc_tagged(length + 1, HGDN_MEMORY_TAG_LOG);
+    if (record->text == NULL) {
+        record->text = record->inline_text;
+        if (record->length >= HGDN_LOG_RECORD_TEXT_SIZE) {
+            record->length = HGDN_LOG_RECORD_TEXT_SIZE - 1;
+        }
+    }
+    memcpy(record->text, text, record->length);
+    record->text[record->length] = '\0';
+    hgdn__atomic_increment(&hgdn__log_stats.enqueued);
+    hgdn__atomic_store(&record->sequence, pos + 1);
+}
+
+static godot_bool hgdn__log_enqueue(int type, const char *funcname, const char *filename, int line, const char *text, godot_int length) {
+    // Messages are printed synchronously most of the time, so that path doesn't touch the counter.
+    // Otherwise, the sequentially consistent increment and load pair with the exchange and load in `hgdn_log_async_stop`:
+    // either it waits for this producer, or the ring is seen as NULL.
+    if (hgdn__atomic_load_ptr(&hgdn__log_ring_ptr) == NULL) {
+        return 0;
+    }
+    hgdn__atomic_increment_seq_cst(&hgdn__log_producers);
+    hgdn__log_ring *ring = (hgdn__log_ring *) hgdn__atomic_load_ptr_seq_cst(&hgdn__log_ring_ptr);
+    if (ring) {
+        hgdn__log_ring_push(ring, type, funcname, filename, line, text, length);
+    }
+    // Leaving must be a release, so the ring is freed only after this producer is done with it
+    int64_t producers;
+    do {
+        producers = hgdn__atomic_load(&hgdn__log_producers);
+    } while (!hgdn__atomic_cas(&hgdn__log_producers, producers, producers - 1));
+    return ring != NULL;
+}
+
+static void hgdn__log_flush_batch(size_t *batch_size) {
+    if (*batch_size > 0) {
+        godot_string str = hgdn_new_string_with_len(hgdn__log_batch, *batch_size);
+        hgdn_core_api->godot_print(&str);
+        hgdn_core_api->godot_string_destroy(&str);
+        *batch_size = 0;
+    }
+}
+
+godot_int hgdn_log_flush() {
+    hgdn__log_ring *ring = (hgdn__log_ring *) hgdn__atomic_load_ptr(&hgdn__log_ring_ptr);
+    return ring ? hgdn__log_flush_ring(ring) : 0;
+}
+
+static godot_int hgdn__log_flush_ring(hgdn__log_ring *ring) {
+    // Consecutive hgdn_print messages are joined by new lines and printed at once
+    size_t batch_size = 0;
+    godot_int count = 0;
+    for (;;) {
+        int64_t pos = ring->dequeue_pos;
+        hgdn__log_record *record = &ring->records[pos & ring->mask];
+        if (hgdn__atomic_load(&record->sequence) != pos + 1) {
+            break;
+        }
+        if (record->type == HGDN__LOG_PRINT) {
+            size_t needed = batch_size + record->length + 1;
+            if (needed > hgdn__log_batch_capacity) {
+                size_t new_capacity = hgdn__log_batch_capacity ? hgdn__log_batch_capacity : 1024;
+                while (new_capacity < needed) {
+                    new_capacity <<= 1;
+                }
+                char *new_batch = (char *) hgdn_realloc_tagged(hgdn__log_batch, new_capacity, HGDN_MEMORY_TAG_LOG);
+                if (new_batch != NULL) {
+                    hgdn__log_batch = new_batch;
+                    hgdn__log_batch_capacity = new_capacity;
+                }
+            }
+            if (needed <= hgdn__log_batch_capacity) {
+                if (batch_size > 0) {
+                    hgdn__log_batch[batch_size++] = '\n';
+                }
+                memcpy(hgdn__log_batch + batch_size, record->text, record->length);
+                batch_size += record->length;
+            }
+            else {
+                godot_string str = hgdn_new_string_with_len(record->text, record->length);
+                hgdn_core_api->godot_print(&str);
+                hgdn_core_api->godot_string_destroy(&str);
+            }
+        }
+        else {
+            hgdn__log_flush_batch(&batch_size);
+            if (record->type == HGDN__LOG_WARNING) {
+                hgdn_core_api->godot_print_warning(record->text, record->funcname, record->filename, record->line);
+            }
+            else {
+                hgdn_core_api->godot_print_error(record->text, record->funcname, record->filename, record->line);
+            }
+        }
+        if (record->text != record->inline_text) {
+            hgdn_free(record->text);
+        }
+        hgdn__atomic_store(&record->sequence, pos + ring->mask + 1);
+        ring->dequeue_pos = pos + 1;
+        count++;
+    }
+    hgdn__log_flush_batch(&batch_size);
+    hgdn__atomic_store(&hgdn__log_stats.flushed, hgdn__log_stats.flushed + count);
+    return count;
+}
+
+hgdn_log_stats hgdn_log_get_stats() {
+    hgdn_log_stats stats = {
+        hgdn__atomic_load(&hgdn__log_stats.enqueued),
+        hgdn__atomic_load(&hgdn__log_stats.flushed),
+        hgdn__atomic_load(&hgdn__log_stats.dropped),
+    };
+    return stats;
 }
 
+// UTF-8 <-> wchar_t transcoding
+// Godot 3 Strings are stored as wchar_t: UTF-32 on most platforms, UTF-16 on Windows.
+// Runs of ASCII characters are converted 16 or 32 at a time with SSE2/AVX2 when available.
+static godot_int hgdn__utf8_length_wide(const wchar_t *wstr, const godot_int len) {
+    godot_int size = 0;
+    godot_int i = 0;
+#ifdef HGDN__SSE2
+    const __m128i non_ascii_mask = HGDN__WIDE_SET1(~0x7F);
+    while (i + 16 <= len) {
+        __m128i any = _mm_setzero_si128();
+        for (int j = 0; j < 16; j += HGDN__WIDE_PER_M128) {
+            any = _mm_or_si128(any, _mm_loadu_si128((const __m128i *) (wstr + i + j)));
+        }
+        if (_mm_movemask_epi8(HGDN__WIDE_CMPEQ(_mm_and_si128(any, non_ascii_mask), _mm_setzero_si128())) != 0xFFFF) {
+            break;
+        }
+        size += 16;
+        i += 16;
+    }
+#endif
+    for ( ; i < len; i++) {
+        uint32_t c = (uint32_t) wstr[i];
+        if (c < 0x80) {
+            size += 1;
+        }
+        else if (c < 0x800) {
+            size += 2;
+        }
+#if WCHAR_MAX <= 0xFFFF
+        else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < len && (uint32_t) wstr[i + 1] >= 0xDC00 && (uint32_t) wstr[i + 1] <= 0xDFFF) {
+            size += 4;
+            i++;
+        }
+#endif
+        else if (c < 0x10000 || c > 0x10FFFF) {
+            // Lone surrogates and code points out of range are replaced by U+FFFD, also 3 bytes long
+            size += 3;
+        }
+        else {
+            size += 4;
+        }
+    }
+    return size;
+}
+
+// Converts 16 ASCII characters at `wstr` to `out`, returning false without writing anything if any of them isn't ASCII
+static godot_bool hgdn__ascii_encode_wide16(char *out, const wchar_t *wstr) {
+#if defined(HGDN__AVX2) && WCHAR_MAX > 0xFFFF
+    __m256i a = _mm256_loadu_si256((const __m256i *) wstr);
+    __m256i b = _mm256_loadu_si256((const __m256i *) (wstr + 8));
+    if (!_mm256_testz_si256(_mm256_or_si256(a, b), _mm256_set1_epi32(~0x7F))) {
+        return 0;
+    }
+    // packs work inside 128-bit lanes, so 32-bit groups end up as a0-3 b0-3 a4-7 b4-7
+    __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_setzero_si256());
+    packed = _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+    _mm_storeu_si128((__m128i *) out, _mm256_castsi256_si128(packed));
+    return 1;
+#elif defined(HGDN__SSE2) && WCHAR_MAX > 0xFFFF
+    __m128i a = _mm_loadu_si128((const __m128i *) wstr);
+    __m128i b = _mm_loadu_si128((const __m128i *) (wstr + 4));
+    __m128i c = _mm_loadu_si128((const __m128i *) (wstr + 8));
+    __m128i d = _mm_loadu_si128((const __m128i *) (wstr + 12));
+    __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, _mm_set1_epi32(~0x7F)), _mm_setzero_si128())) != 0xFFFF) {
+        return 0;
+    }
+    _mm_storeu_si128((__m128i *) out, _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    return 1;
+#elif defined(HGDN__SSE2)
+    __m128i a = _mm_loadu_si128((const __m128i *) wstr);
+    __m128i b = _mm_loadu_si128((const __m128i *) (wstr + 8));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi16(~0x7F)), _mm_setzero_si128())) != 0xFFFF) {
+        return 0;
+    }
+    _mm_storeu_si128((__m128i *) out, _mm_packus_epi16(a, b));
+    return 1;
+#else
+    uint32_t any = 0;
+    for (int i = 0; i < 16; i++) {
+        any |= (uint32_t) wstr[i];
+    }
+    if (any >= 0x80) {
+        return 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        out[i] = (char) wstr[i];
+    }
+    return 1;
+#endif
+}
+
+static char *hgdn__utf8_encode_wide(char *out, const wchar_t *wstr, const godot_int len) {
+    godot_int i = 0;
+    while (i < len) {
+        if (i + 16 <= len && hgdn__ascii_encode_wide16(out, wstr + i)) {
+            out += 16;
+            i += 16;
+            continue;
+        }
+        // Encode characters one by one until the next 16 character block
+        godot_int block_end = i + 16 < len ? i + 16 : len;
+        for ( ; i < block_end; i++) {
+            uint32_t c = (uint32_t) wstr[i];
+#if WCHAR_MAX <= 0xFFFF
+            if (c >= 0xD800 && c <= 0xDBFF && i + 1 < len && (uint32_t) wstr[i + 1] >= 0xDC00 && (uint32_t) wstr[i + 1] <= 0xDFFF) {
+                c = 0x10000 + ((c - 0xD800) << 10) + ((uint32_t) wstr[i + 1] - 0xDC00);
+                i++;
+            }
+#endif
+            if (c < 0x80) {
+                *out++ = (char) c;
+            }
+            else if (c < 0x800) {
+                *out++ = (char) (0xC0 | (c >> 6));
+                *out++ = (char) (0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000 || c > 0x10FFFF) {
+                // Surrogates can't be encoded in UTF-8, so lone ones are replaced just like out of range code points
+                if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+                    c = 0xFFFD;
+                }
+                *out++ = (char) (0xE0 | (c >> 12));
+                *out++ = (char) (0x80 | ((c >> 6) & 0x3F));
+                *out++ = (char) (0x80 | (c & 0x3F));
+            }
+            else {
+                *out++ = (char) (0xF0 | (c >> 18));
+                *out++ = (char) (0x80 | ((c >> 12) & 0x3F));
+                *out++ = (char) (0x80 | ((c >> 6) & 0x3F));
+                *out++ = (char) (0x80 | (c & 0x3F));
+            }
+        }
+    }
+    return out;
+}
+
+#ifdef HGDN_USE_UTF8_TRANSCODER
+// Widens 16 ASCII bytes at `str` to `out`, returning false without writing anything if any of them isn't ASCII
+static godot_bool hgdn__ascii_decode_wide16(wchar_t *out, const uint8_t *str) {
+#ifdef HGDN__SSE2
+    __m128i chunk = _mm_loadu_si128((const __m128i *) str);
+    if (_mm_movemask_epi8(chunk) != 0) {
+        return 0;
+    }
+    #if defined(HGDN__AVX2) && WCHAR_MAX > 0xFFFF
+    _mm256_storeu_si256((__m256i *) out, _mm256_cvtepu8_epi32(chunk));
+    _mm256_storeu_si256((__m256i *) (out + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(chunk, 8)));
+    #elif WCHAR_MAX > 0xFFFF
+    __m128i lo = _mm_unpacklo_epi8(chunk, _mm_setzero_si128());
+    __m128i hi = _mm_unpackhi_epi8(chunk, _mm_setzero_si128());
+    _mm_storeu_si128((__m128i *) out, _mm_unpacklo_epi16(lo, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *) (out + 4), _mm_unpackhi_epi16(lo, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *) (out + 8), _mm_unpacklo_epi16(hi, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *) (out + 12), _mm_unpackhi_epi16(hi, _mm_setzero_si128()));
+    #else
+    _mm_storeu_si128((__m128i *) out, _mm_unpacklo_epi8(chunk, _mm_setzero_si128()));
+    _mm_storeu_si128((__m128i *) (out + 8), _mm_unpackhi_epi8(chunk, _mm_setzero_si128()));
+    #endif
+    return 1;
+#else
+    uint64_t words[2];
+    memcpy(words, str, sizeof(words));
+    if (((words[0] | words[1]) & 0x8080808080808080ull) != 0) {
+        return 0;
+    }
+    for (int i = 0; i < 16; i++) {
+        out[i] = (wchar_t) str[i];
+    }
+    return 1;
+#endif
+}
+
+// Writes at most `len` characters to `out`, returning how many were written.
+// Invalid sequences are replaced by U+FFFD.
+static godot_int hgdn__utf8_decode_wide(wchar_t *out, const char *str, const godot_int len) {
+    const uint8_t *s = (const uint8_t *) str;
+    wchar_t *o = out;
+    godot_int i = 0;
+    while (i < len) {
+        if (i + 16 <= len && hgdn__ascii_decode_wide16(o, s + i)) {
+            o += 16;
+            i += 16;
+            continue;
+        }
+        // Decode characters one by one until the next 16 byte block
+        godot_int block_end = i + 16 < len ? i + 16 : len;
+        while (i < block_end) {
+            uint32_t c = s[i];
+            if (c < 0x80) {
+                i += 1;
+            }
+            else if ((c & 0xE0) == 0xC0 && i + 1 < len && (s[i + 1] & 0xC0) == 0x80) {
+                c = ((c & 0x1F) << 6) | (s[i + 1] & 0x3F);
+                if (c < 0x80) {
+                    c = 0xFFFD;
+                }
+                i += 2;
+            }
+            else if ((c & 0xF0) == 0xE0 && i + 2 < len && (s[i + 1] & 0xC0) == 0x80 && (s[i + 2] & 0xC0) == 0x80) {
+                c = ((c & 0x0F) << 12) | ((s[i + 1] & 0x3F) << 6) | (s[i + 2] & 0x3F);
+                if (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF)) {
+                    c = 0xFFFD;
+                }
+                i += 3;
+            }
+            else if ((c & 0xF8) == 0xF0 && i + 3 < len && (s[i + 1] & 0xC0) == 0x80 && (s[i + 2] & 0xC0) == 0x80 && (s[i + 3] & 0xC0) == 0x80) {
+                c = ((c & 0x07) << 18) | ((s[i + 1] & 0x3F) << 12) | ((s[i + 2] & 0x3F) << 6) | (s[i + 3] & 0x3F);
+                if (c < 0x10000 || c > 0x10FFFF) {
+                    c = 0xFFFD;
+                }
+                i += 4;
+            }
+            else {
+                c = 0xFFFD;
+                i += 1;
+            }
+#if WCHAR_MAX <= 0xFFFF
+            if (c >= 0x10000) {
+                *o++ = (wchar_t) (0xD800 + ((c - 0x10000) >> 10));
+                *o++ = (wchar_t) (0xDC00 + ((c - 0x10000) & 0x3FF));
+                continue;
+            }
+#endif
+            *o++ = (wchar_t) c;
+        }
+    }
+    return (godot_int) (o - out);
+}
+
+// Decodes UTF-8 with the functions above and builds the String from wide characters
+static godot_string hgdn__new_string_transcoded(const char *cstr, const godot_int len) {
+    godot_string str;
+    if (len <= 0) {
+        hgdn_core_api->godot_string_new(&str);
+        return str;
+    }
+    wchar_t stack_buffer[256];
+    wchar_t *buffer = len < 256 ? stack_buffer : (wchar_t *) hgdn_alloc_tagged(len * sizeof(wchar_t), HGDN_MEMORY_TAG_STRING);
+    if (buffer == NULL) {
+        return hgdn_core_api->godot_string_chars_to_utf8_with_len(cstr, len);
+    }
+    godot_int wide_len = hgdn__utf8_decode_wide(buffer, cstr, len);
+    hgdn_core_api->godot_string_new_with_wide_string(&str, buffer, wide_len);
+    if (buffer != stack_buffer) {
+        hgdn_free(buffer);
+    }
+    return str;
+}
+#endif
+
 // String creation API
 godot_string hgdn_new_wide_string(const wchar_t *wstr) {
     godot_string str;
@@ -1261,6 +3575,15 @@ godot_string hgdn_new_wide_string_with_len(const wchar_t *wstr, const godot_int
     return str;
 }
 
+#ifdef HGDN_USE_UTF8_TRANSCODER
+godot_string hgdn_new_string(const char *cstr) {
+    return hgdn__new_string_transcoded(cstr, strlen(cstr));
+}
+
+godot_string hgdn_new_string_with_len(const char *cstr, const godot_int len) {
+    return hgdn__new_string_transcoded(cstr, len);
+}
+#else
 godot_string hgdn_new_string(const char *cstr) {
     return hgdn_core_api->godot_string_chars_to_utf8(cstr);
 }
@@ -1268,44 +3591,254 @@ godot_string hgdn_new_string(const char *cstr) {
 godot_string hgdn_new_string_with_len(const char *cstr, const godot_int len) {
     return hgdn_core_api->godot_string_chars_to_utf8_with_len(cstr, len);
 }
+#endif
 
 godot_string hgdn_new_formatted_string(const char *fmt, ...) {
     HGDN__FILL_FORMAT_BUFFER(fmt, ...);
-    return hgdn_new_string_with_len(hgdn__format_string_buffer, size);
+    godot_string str = hgdn_new_string_with_len(format_buffer, size);
+    hgdn__format_release(format_buffer);
+    return str;
+}
+
+// String builder API
+godot_bool hgdn_string_builder_reserve(hgdn_string_builder *builder, const godot_int additional) {
+    // godot_int is an int, Strings can't be any longer than that
+    if (additional < 0 || additional > INT_MAX - 1 - builder->length) {
+        return 0;
+    }
+    godot_int needed = builder->length + additional + 1;  // account for the NULL terminator
+    if (needed <= builder->capacity) {
+        return 1;
+    }
+    godot_int new_capacity = builder->capacity ? builder->capacity : 64;
+    while (new_capacity < needed) {
+        new_capacity = new_capacity <= INT_MAX / 2 ? new_capacity * 2 : needed;
+    }
+    char *new_ptr = (char *) hgdn_realloc_tagged(builder->ptr, new_capacity, HGDN_MEMORY_TAG_STRING);
+    if (new_ptr == NULL) {
+        return 0;
+    }
+    builder->ptr = new_ptr;
+    builder->capacity = new_capacity;
+    return 1;
+}
+
+void hgdn_string_builder_append_with_len(hgdn_string_builder *builder, const char *cstr, const godot_int len) {
+    if (hgdn_string_builder_reserve(builder, len)) {
+        memcpy(builder->ptr + builder->length, cstr, len);
+        builder->length += len;
+        builder->ptr[builder->length] = '\0';
+    }
+}
+
+void hgdn_string_builder_append(hgdn_string_builder *builder, const char *cstr) {
+    hgdn_string_builder_append_with_len(builder, cstr, strlen(cstr));
+}
+
+void hgdn_string_builder_append_char(hgdn_string_builder *builder, const char c) {
+    hgdn_string_builder_append_with_len(builder, &c, 1);
+}
+
+static void hgdn__string_builder_vappendf(hgdn_string_builder *builder, const char *fmt, va_list args) {
+    // Try formatting in place first, growing and formatting again only if needed
+    godot_int available = builder->capacity > builder->length ? builder->capacity - builder->length : 0;
+    va_list args_copy;
+    va_copy(args_copy, args);
+    int size = vsnprintf(available ? builder->ptr + builder->length : NULL, available, fmt, args_copy);
+    va_end(args_copy);
+    if (size < 0) {
+        return;
+    }
+    if (size >= available) {
+        if (!hgdn_string_builder_reserve(builder, size)) {
+            if (available) {
+                builder->ptr[builder->length] = '\0';
+            }
+            return;
+        }
+        vsnprintf(builder->ptr + builder->length, size + 1, fmt, args);
+    }
+    builder->length += size;
+}
+
+void hgdn_string_builder_appendf(hgdn_string_builder *builder, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    hgdn__string_builder_vappendf(builder, fmt, args);
+    va_end(args);
+}
+
+void hgdn_string_builder_append_int(hgdn_string_builder *builder, const int64_t value) {
+    char buffer[24];
+    char *end = buffer + sizeof(buffer), *it = end;
+    uint64_t magnitude = value < 0 ? 0 - (uint64_t) value : (uint64_t) value;
+    do {
+        *--it = (char) ('0' + magnitude % 10);
+        magnitude /= 10;
+    } while (magnitude);
+    if (value < 0) {
+        *--it = '-';
+    }
+    hgdn_string_builder_append_with_len(builder, it, end - it);
+}
+
+// Same as Godot 3's `String::num` with default decimals: "%lf" without trailing zeros
+void hgdn_string_builder_append_real(hgdn_string_builder *builder, const double value) {
+    godot_int start = builder->length;
+    hgdn_string_builder_appendf(builder, "%f", value);
+    if (builder->length > start && memchr(builder->ptr + start, '.', builder->length - start)) {
+        while (builder->ptr[builder->length - 1] == '0') {
+            builder->length--;
+        }
+        if (builder->ptr[builder->length - 1] == '.') {
+            builder->length--;
+        }
+        builder->ptr[builder->length] = '\0';
+    }
+}
+
+static void hgdn__string_builder_append_reals(hgdn_string_builder *builder, const float *values, const int count, const char *separator) {
+    size_t separator_length = strlen(separator);
+    for (int i = 0; i < count; i++) {
+        if (i > 0) {
+            hgdn_string_builder_append_with_len(builder, separator, separator_length);
+        }
+        hgdn_string_builder_append_real(builder, values[i]);
+    }
+}
+
+void hgdn_string_builder_append_vector2(hgdn_string_builder *builder, const godot_vector2 value) {
+    const float values[] = { value.x, value.y };
+    hgdn_string_builder_append_char(builder, '(');
+    hgdn__string_builder_append_reals(builder, values, 2, ", ");
+    hgdn_string_builder_append_char(builder, ')');
+}
+
+void hgdn_string_builder_append_vector3(hgdn_string_builder *builder, const godot_vector3 value) {
+    const float values[] = { value.x, value.y, value.z };
+    hgdn_string_builder_append_char(builder, '(');
+    hgdn__string_builder_append_reals(builder, values, 3, ", ");
+    hgdn_string_builder_append_char(builder, ')');
+}
+
+void hgdn_string_builder_append_color(hgdn_string_builder *builder, const godot_color value) {
+    const float values[] = { value.r, value.g, value.b, value.a };
+    hgdn__string_builder_append_reals(builder, values, 4, ",");
+}
+
+void hgdn_string_builder_append_basis(hgdn_string_builder *builder, const godot_basis value) {
+    hgdn__string_builder_append_reals(builder, value.elements, 9, ", ");
+}
+
+void hgdn_string_builder_append_transform(hgdn_string_builder *builder, const godot_transform value) {
+    hgdn_string_builder_append_basis(builder, value.basis);
+    hgdn_string_builder_append_with_len(builder, " - ", 3);
+    hgdn_string_builder_append_vector3(builder, value.origin);
+}
+
+void hgdn_string_builder_clear(hgdn_string_builder *builder) {
+    builder->length = 0;
+    if (builder->ptr) {
+        builder->ptr[0] = '\0';
+    }
+}
+
+void hgdn_string_builder_destroy(hgdn_string_builder *builder) {
+    hgdn_free(builder->ptr);
+    builder->ptr = NULL;
+    builder->length = 0;
+    builder->capacity = 0;
+}
+
+godot_string hgdn_string_builder_to_string(const hgdn_string_builder *builder) {
+    return hgdn_new_string_with_len(builder->ptr ? builder->ptr : "", builder->length);
+}
+
+godot_string hgdn_string_builder_to_string_own(hgdn_string_builder *builder) {
+    godot_string str = hgdn_string_builder_to_string(builder);
+    hgdn_string_builder_destroy(builder);
+    return str;
 }
 
 // Array creation API
-#define HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(kind, ctype) \
-    godot_pool_##kind##_array hgdn_new_##kind##_array(const ctype *buffer, const godot_int size) { \
+#define HGDN_DECLARE_NEW_POOL_ARRAY_UNINIT_FUNC(kind) \
+    godot_pool_##kind##_array hgdn_new_##kind##_array_uninit(const godot_int size) { \
         godot_pool_##kind##_array array; \
         hgdn_core_api->godot_pool_##kind##_array_new(&array); \
         hgdn_core_api->godot_pool_##kind##_array_resize(&array, size); \
+        return array; \
+    }
+#define HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(kind, ctype) \
+    HGDN_DECLARE_NEW_POOL_ARRAY_UNINIT_FUNC(kind) \
+    godot_pool_##kind##_array hgdn_new_##kind##_array(const ctype *buffer, const godot_int size) { \
+        godot_pool_##kind##_array array = hgdn_new_##kind##_array_uninit(size); \
         godot_pool_##kind##_array_write_access *write = hgdn_core_api->godot_pool_##kind##_array_write(&array); \
         memcpy(hgdn_core_api->godot_pool_##kind##_array_write_access_ptr(write), buffer, size * sizeof(ctype)); \
         hgdn_core_api->godot_pool_##kind##_array_write_access_destroy(write); \
         return array; \
     }
 
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(byte, uint8_t)  // hgdn_new_byte_array
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(int, godot_int)  // hgdn_new_int_array
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(real, godot_real)  // hgdn_new_real_array
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(vector2, godot_vector2)  // hgdn_new_vector2_array
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(vector3, godot_vector3)  // hgdn_new_vector3_array
-HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(color, godot_color)  // hgdn_new_color_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(byte, uint8_t)  // hgdn_new_byte_array_uninit, hgdn_new_byte_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(int, godot_int)  // hgdn_new_int_array_uninit, hgdn_new_int_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(real, godot_real)  // hgdn_new_real_array_uninit, hgdn_new_real_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(vector2, godot_vector2)  // hgdn_new_vector2_array_uninit, hgdn_new_vector2_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(vector3, godot_vector3)  // hgdn_new_vector3_array_uninit, hgdn_new_vector3_array
+HGDN_DECLARE_NEW_POOL_ARRAY_FUNC(color, godot_color)  // hgdn_new_color_array_uninit, hgdn_new_color_array
+HGDN_DECLARE_NEW_POOL_ARRAY_UNINIT_FUNC(string)  // hgdn_new_string_array_uninit
 
+// Strings are created directly in the pool's storage, instead of being copied with `godot_pool_string_array_set`
 godot_pool_string_array hgdn_new_string_array(const char *const *buffer, const godot_int size) {
-    godot_pool_string_array array;
-    hgdn_core_api->godot_pool_string_array_new(&array);
-    hgdn_core_api->godot_pool_string_array_resize(&array, size);
+    godot_pool_string_array array = hgdn_new_string_array_uninit(size);
+    godot_pool_string_array_write_access *write = hgdn_core_api->godot_pool_string_array_write(&array);
+    godot_string *strings = hgdn_core_api->godot_pool_string_array_write_access_ptr(write);
     for (godot_int i = 0; i < size; i++) {
-        godot_string str = hgdn_core_api->godot_string_chars_to_utf8(buffer[i]);
-        hgdn_core_api->godot_pool_string_array_set(&array, i, &str);
-        hgdn_core_api->godot_string_destroy(&str);
+        hgdn_core_api->godot_string_destroy(&strings[i]);
+        strings[i] = hgdn_new_string(buffer[i]);
+    }
+    hgdn_core_api->godot_pool_string_array_write_access_destroy(write);
+    return array;
+}
+
+godot_pool_string_array hgdn_new_string_array_packed(const char *data, const godot_int *offsets, const godot_int size) {
+    godot_pool_string_array array = hgdn_new_string_array_uninit(size);
+    godot_pool_string_array_write_access *write = hgdn_core_api->godot_pool_string_array_write(&array);
+    godot_string *strings = hgdn_core_api->godot_pool_string_array_write_access_ptr(write);
+    for (godot_int i = 0; i < size; i++) {
+        hgdn_core_api->godot_string_destroy(&strings[i]);
+        strings[i] = hgdn_new_string_with_len(data + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+    hgdn_core_api->godot_pool_string_array_write_access_destroy(write);
+    return array;
+}
+
+godot_pool_string_array hgdn_new_string_array_split(const char *buffer, godot_int len, const char separator) {
+    if (len < 0) {
+        len = strlen(buffer);
+    }
+    const char *end = buffer + len;
+    godot_int size = 1;
+    for (const char *it = buffer; (it = (const char *) memchr(it, separator, end - it)) != NULL; it++) {
+        size++;
+    }
+    godot_pool_string_array array = hgdn_new_string_array_uninit(size);
+    godot_pool_string_array_write_access *write = hgdn_core_api->godot_pool_string_array_write(&array);
+    godot_string *strings = hgdn_core_api->godot_pool_string_array_write_access_ptr(write);
+    const char *start = buffer;
+    for (godot_int i = 0; i < size; i++) {
+        const char *sep = (const char *) memchr(start, separator, end - start);
+        if (sep == NULL) {
+            sep = end;
+        }
+        hgdn_core_api->godot_string_destroy(&strings[i]);
+        strings[i] = hgdn_new_string_with_len(start, sep - start);
+        start = sep + 1;
     }
+    hgdn_core_api->godot_pool_string_array_write_access_destroy(write);
     return array;
 }
 
 #undef HGDN_DECLARE_NEW_POOL_ARRAY_FUNC
+#undef HGDN_DECLARE_NEW_POOL_ARRAY_UNINIT_FUNC
 
 godot_array hgdn_new_array(const godot_variant *const *buffer, const godot_int size) {
     godot_array array;
@@ -1317,19 +3850,82 @@ godot_array hgdn_new_array(const godot_variant *const *buffer, const godot_int s
     return array;
 }
 
-godot_array hgdn_new_array_own(godot_variant *buffer, const godot_int size) {
+// Variants hold no pointers to themselves, so they can be moved by copying their bytes,
+// as long as the source is not destroyed afterwards. Slots are null right after a resize.
+static void hgdn__array_emplace(godot_array *array, const godot_int index, const godot_variant *value) {
+    *hgdn_core_api->godot_array_operator_index(array, index) = *value;
+}
+
+godot_array hgdn_new_array_own(godot_variant *buffer, const godot_int size) {
+    godot_array array;
+    hgdn_core_api->godot_array_new(&array);
+    hgdn_core_api->godot_array_resize(&array, size);
+    for (godot_int i = 0; i < size; i++) {
+        hgdn__array_emplace(&array, i, &buffer[i]);
+    }
+    return array;
+}
+
+// Array builder API
+void hgdn_array_builder_reserve(hgdn_array_builder *builder, const godot_int additional) {
+    godot_int needed = builder->size + additional;
+    if (needed <= builder->capacity) {
+        return;
+    }
+    godot_int new_capacity = builder->capacity ? builder->capacity : 16;
+    while (new_capacity < needed) {
+        new_capacity *= 2;
+    }
+    if (builder->capacity == 0) {
+        hgdn_core_api->godot_array_new(&builder->array);
+    }
+    hgdn_core_api->godot_array_resize(&builder->array, new_capacity);
+    builder->capacity = new_capacity;
+}
+
+godot_variant *hgdn_array_builder_push_slot(hgdn_array_builder *builder) {
+    hgdn_array_builder_reserve(builder, 1);
+    return hgdn_core_api->godot_array_operator_index(&builder->array, builder->size++);
+}
+
+void hgdn_array_builder_push(hgdn_array_builder *builder, const godot_variant *value) {
+    hgdn_core_api->godot_variant_new_copy(hgdn_array_builder_push_slot(builder), value);
+}
+
+void hgdn_array_builder_push_own(hgdn_array_builder *builder, godot_variant value) {
+    *hgdn_array_builder_push_slot(builder) = value;
+}
+
+godot_array hgdn_array_builder_finish(hgdn_array_builder *builder) {
     godot_array array;
-    hgdn_core_api->godot_array_new(&array);
-    hgdn_core_api->godot_array_resize(&array, size);
-    for (godot_int i = 0; i < size; i++) {
-        godot_variant *var = &buffer[i];
-        hgdn_core_api->godot_array_set(&array, i, var);
-        hgdn_core_api->godot_variant_destroy(var);
+    if (builder->capacity == 0) {
+        hgdn_core_api->godot_array_new(&array);
+    }
+    else {
+        array = builder->array;
+        if (builder->size < builder->capacity) {
+            hgdn_core_api->godot_array_resize(&array, builder->size);
+        }
     }
+    builder->size = builder->capacity = 0;
     return array;
 }
 
+void hgdn_array_builder_destroy(hgdn_array_builder *builder) {
+    if (builder->capacity > 0) {
+        hgdn_core_api->godot_array_destroy(&builder->array);
+    }
+    builder->size = builder->capacity = 0;
+}
+
 // Dictionary creation API
+// Like `godot_dictionary_set` followed by destroying `value`, but moves it into the Dictionary instead of copying
+static void hgdn__dictionary_set_own(godot_dictionary *dict, const godot_variant *key, godot_variant *value) {
+    godot_variant *slot = hgdn_core_api->godot_dictionary_operator_index(dict, key);
+    hgdn_core_api->godot_variant_destroy(slot);
+    *slot = *value;
+}
+
 godot_dictionary hgdn_new_dictionary(const hgdn_dictionary_entry *buffer, const godot_int size) {
     godot_dictionary dict;
     hgdn_core_api->godot_dictionary_new(&dict);
@@ -1369,9 +3965,8 @@ godot_dictionary hgdn_new_dictionary_string_string(const hgdn_dictionary_entry_s
     for (godot_int i = 0; i < size; i++) {
         godot_variant key = hgdn_new_string_variant_own(hgdn_new_string(buffer[i].key));
         godot_variant value = hgdn_new_string_variant_own(hgdn_new_string(buffer[i].value));
-        hgdn_core_api->godot_dictionary_set(&dict, &key, &value);
+        hgdn__dictionary_set_own(&dict, &key, &value);
         hgdn_core_api->godot_variant_destroy(&key);
-        hgdn_core_api->godot_variant_destroy(&value);
     }
     return dict;
 }
@@ -1380,9 +3975,8 @@ godot_dictionary hgdn_new_dictionary_own(hgdn_dictionary_entry_own *buffer, cons
     godot_dictionary dict;
     hgdn_core_api->godot_dictionary_new(&dict);
     for (godot_int i = 0; i < size; i++) {
-        hgdn_core_api->godot_dictionary_set(&dict, &buffer[i].key, &buffer[i].value);
+        hgdn__dictionary_set_own(&dict, &buffer[i].key, &buffer[i].value);
         hgdn_core_api->godot_variant_destroy(&buffer[i].key);
-        hgdn_core_api->godot_variant_destroy(&buffer[i].value);
     }
     return dict;
 }
@@ -1392,9 +3986,174 @@ godot_dictionary hgdn_new_dictionary_string_own(hgdn_dictionary_entry_string_own
     hgdn_core_api->godot_dictionary_new(&dict);
     for (godot_int i = 0; i < size; i++) {
         godot_variant key = hgdn_new_string_variant_own(hgdn_new_string(buffer[i].key));
-        hgdn_core_api->godot_dictionary_set(&dict, &key, &buffer[i].value);
+        hgdn__dictionary_set_own(&dict, &key, &buffer[i].value);
         hgdn_core_api->godot_variant_destroy(&key);
-        hgdn_core_api->godot_variant_destroy(&buffer[i].value);
+    }
+    return dict;
+}
+
+godot_dictionary hgdn_new_dictionary_key(const hgdn_dictionary_entry_key *buffer, const godot_int size) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (godot_int i = 0; i < size; i++) {
+        if (buffer[i].key) {
+            hgdn_core_api->godot_dictionary_set(&dict, &buffer[i].key->variant, buffer[i].value);
+        }
+    }
+    return dict;
+}
+
+godot_dictionary hgdn_new_dictionary_key_int(const hgdn_dictionary_entry_key_int *buffer, const godot_int size) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (godot_int i = 0; i < size; i++) {
+        if (buffer[i].key) {
+            godot_variant value = hgdn_new_int_variant(buffer[i].value);
+            hgdn_core_api->godot_dictionary_set(&dict, &buffer[i].key->variant, &value);
+            hgdn_core_api->godot_variant_destroy(&value);
+        }
+    }
+    return dict;
+}
+
+godot_dictionary hgdn_new_dictionary_key_string(const hgdn_dictionary_entry_key_string *buffer, const godot_int size) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (godot_int i = 0; i < size; i++) {
+        if (buffer[i].key) {
+            godot_variant value = hgdn_new_string_variant_own(hgdn_new_string(buffer[i].value));
+            hgdn__dictionary_set_own(&dict, &buffer[i].key->variant, &value);
+        }
+    }
+    return dict;
+}
+
+godot_dictionary hgdn_new_dictionary_key_own(hgdn_dictionary_entry_key_own *buffer, const godot_int size) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (godot_int i = 0; i < size; i++) {
+        if (buffer[i].key) {
+            hgdn__dictionary_set_own(&dict, &buffer[i].key->variant, &buffer[i].value);
+        }
+        else {
+            hgdn_core_api->godot_variant_destroy(&buffer[i].value);
+        }
+    }
+    return dict;
+}
+
+// Struct <-> Dictionary API
+hgdn_struct_schema hgdn_new_struct_schema(const hgdn_struct_field *fields) {
+    hgdn_struct_schema schema = { fields, NULL, 0 };
+    godot_int size = 0;
+    while (fields[size].name) {
+        size++;
+    }
+    if ((schema.keys = (hgdn_key *) hgdn_alloc_tagged(size * sizeof(hgdn_key), HGDN_MEMORY_TAG_CACHE)) == NULL) {
+        return schema;
+    }
+    for (godot_int i = 0; i < size; i++) {
+        if ((schema.keys[i] = hgdn_intern_key(fields[i].name)) == NULL) {
+            hgdn_free(schema.keys);
+            schema.keys = NULL;
+            return schema;
+        }
+    }
+    schema.size = size;
+    return schema;
+}
+
+void hgdn_struct_schema_destroy(hgdn_struct_schema *schema) {
+    // keys are interned, only the array is owned by the schema
+    hgdn_free(schema->keys);
+    schema->keys = NULL;
+    schema->size = 0;
+}
+
+#define HGDN__STRUCT_FIELD(ctype)  (*(ctype *) ((uint8_t *) data + field->offset))
+#define HGDN__CONST_STRUCT_FIELD(ctype)  (*(const ctype *) ((const uint8_t *) data + field->offset))
+
+static void hgdn__struct_field_from_variant(void *data, const hgdn_struct_field *field, const godot_variant *value) {
+    switch (field->type) {
+        case HGDN_FIELD_BOOL: HGDN__STRUCT_FIELD(godot_bool) = hgdn_variant_get_bool(value); break;
+        case HGDN_FIELD_INT: HGDN__STRUCT_FIELD(godot_int) = (godot_int) hgdn_variant_get_int(value); break;
+        case HGDN_FIELD_INT64: HGDN__STRUCT_FIELD(int64_t) = hgdn_variant_get_int(value); break;
+        case HGDN_FIELD_REAL: HGDN__STRUCT_FIELD(godot_real) = (godot_real) hgdn_variant_get_real(value); break;
+        case HGDN_FIELD_DOUBLE: HGDN__STRUCT_FIELD(double) = hgdn_variant_get_real(value); break;
+        case HGDN_FIELD_VECTOR2: HGDN__STRUCT_FIELD(godot_vector2) = hgdn_variant_get_vector2(value); break;
+        case HGDN_FIELD_VECTOR3: HGDN__STRUCT_FIELD(godot_vector3) = hgdn_variant_get_vector3(value); break;
+        case HGDN_FIELD_RECT2: HGDN__STRUCT_FIELD(godot_rect2) = hgdn_variant_get_rect2(value); break;
+        case HGDN_FIELD_PLANE: HGDN__STRUCT_FIELD(godot_plane) = hgdn_variant_get_plane(value); break;
+        case HGDN_FIELD_QUAT: HGDN__STRUCT_FIELD(godot_quat) = hgdn_variant_get_quat(value); break;
+        case HGDN_FIELD_AABB: HGDN__STRUCT_FIELD(godot_aabb) = hgdn_variant_get_aabb(value); break;
+        case HGDN_FIELD_BASIS: HGDN__STRUCT_FIELD(godot_basis) = hgdn_variant_get_basis(value); break;
+        case HGDN_FIELD_TRANSFORM2D: HGDN__STRUCT_FIELD(godot_transform2d) = hgdn_variant_get_transform2d(value); break;
+        case HGDN_FIELD_TRANSFORM: HGDN__STRUCT_FIELD(godot_transform) = hgdn_variant_get_transform(value); break;
+        case HGDN_FIELD_COLOR: HGDN__STRUCT_FIELD(godot_color) = hgdn_variant_get_color(value); break;
+        case HGDN_FIELD_OBJECT: HGDN__STRUCT_FIELD(godot_object *) = hgdn_variant_get_object(value); break;
+        case HGDN_FIELD_STRING:
+            hgdn_core_api->godot_string_destroy(&HGDN__STRUCT_FIELD(godot_string));
+            HGDN__STRUCT_FIELD(godot_string) = hgdn_core_api->godot_variant_as_string(value);
+            break;
+        case HGDN_FIELD_VARIANT:
+            hgdn_core_api->godot_variant_destroy(&HGDN__STRUCT_FIELD(godot_variant));
+            hgdn_core_api->godot_variant_new_copy(&HGDN__STRUCT_FIELD(godot_variant), value);
+            break;
+    }
+}
+
+static godot_variant hgdn__struct_field_to_variant(const void *data, const hgdn_struct_field *field) {
+    switch (field->type) {
+        case HGDN_FIELD_BOOL: return hgdn_new_bool_variant(HGDN__CONST_STRUCT_FIELD(godot_bool));
+        case HGDN_FIELD_INT: return hgdn_new_int_variant(HGDN__CONST_STRUCT_FIELD(godot_int));
+        case HGDN_FIELD_INT64: return hgdn_new_int_variant(HGDN__CONST_STRUCT_FIELD(int64_t));
+        case HGDN_FIELD_REAL: return hgdn_new_real_variant(HGDN__CONST_STRUCT_FIELD(godot_real));
+        case HGDN_FIELD_DOUBLE: return hgdn_new_real_variant(HGDN__CONST_STRUCT_FIELD(double));
+        case HGDN_FIELD_VECTOR2: return hgdn_new_vector2_variant(HGDN__CONST_STRUCT_FIELD(godot_vector2));
+        case HGDN_FIELD_VECTOR3: return hgdn_new_vector3_variant(HGDN__CONST_STRUCT_FIELD(godot_vector3));
+        case HGDN_FIELD_RECT2: return hgdn_new_rect2_variant(HGDN__CONST_STRUCT_FIELD(godot_rect2));
+        case HGDN_FIELD_PLANE: return hgdn_new_plane_variant(HGDN__CONST_STRUCT_FIELD(godot_plane));
+        case HGDN_FIELD_QUAT: return hgdn_new_quat_variant(HGDN__CONST_STRUCT_FIELD(godot_quat));
+        case HGDN_FIELD_AABB: return hgdn_new_aabb_variant(HGDN__CONST_STRUCT_FIELD(godot_aabb));
+        case HGDN_FIELD_BASIS: return hgdn_new_basis_variant(HGDN__CONST_STRUCT_FIELD(godot_basis));
+        case HGDN_FIELD_TRANSFORM2D: return hgdn_new_transform2d_variant(HGDN__CONST_STRUCT_FIELD(godot_transform2d));
+        case HGDN_FIELD_TRANSFORM: return hgdn_new_transform_variant(HGDN__CONST_STRUCT_FIELD(godot_transform));
+        case HGDN_FIELD_COLOR: return hgdn_new_color_variant(HGDN__CONST_STRUCT_FIELD(godot_color));
+        case HGDN_FIELD_OBJECT: return hgdn_new_object_variant(HGDN__CONST_STRUCT_FIELD(godot_object *));
+        case HGDN_FIELD_STRING: return hgdn_new_string_variant(&HGDN__CONST_STRUCT_FIELD(godot_string));
+        case HGDN_FIELD_VARIANT: return hgdn_new_variant_copy(&HGDN__CONST_STRUCT_FIELD(godot_variant));
+    }
+    return hgdn_new_nil_variant();
+}
+
+#undef HGDN__CONST_STRUCT_FIELD
+#undef HGDN__STRUCT_FIELD
+
+godot_int hgdn_struct_from_dictionary(void *data, const hgdn_struct_schema *schema, const godot_dictionary *dict) {
+    // One lookup per field, checking presence first because Godot 3's const operator[] crashes on missing keys
+    godot_int fields_read = 0;
+    for (godot_int i = 0; i < schema->size; i++) {
+        const godot_variant *key = &schema->keys[i]->variant;
+        if (hgdn_core_api->godot_dictionary_has(dict, key)) {
+            hgdn__struct_field_from_variant(data, &schema->fields[i], hgdn_core_api->godot_dictionary_operator_index_const(dict, key));
+            fields_read++;
+        }
+    }
+    return fields_read;
+}
+
+godot_dictionary hgdn_struct_to_dictionary(const void *data, const hgdn_struct_schema *schema) {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    for (godot_int i = 0; i < schema->size; i++) {
+        const hgdn_struct_field *field = &schema->fields[i];
+        if (field->type == HGDN_FIELD_VARIANT) {
+            hgdn_core_api->godot_dictionary_set(&dict, &schema->keys[i]->variant, (const godot_variant *) ((const uint8_t *) data + field->offset));
+        }
+        else {
+            godot_variant value = hgdn__struct_field_to_variant(data, field);
+            hgdn__dictionary_set_own(&dict, &schema->keys[i]->variant, &value);
+        }
     }
     return dict;
 }
@@ -1419,6 +4178,28 @@ void hgdn_wide_string_destroy(hgdn_wide_string *str) {
     hgdn_core_api->godot_string_destroy(&str->gd_string);
 }
 
+#ifdef HGDN_USE_UTF8_TRANSCODER
+static const char hgdn__empty_cstring[] = "";
+
+// Encodes the String's wide characters directly, skipping the CharString created by `godot_string_utf8`
+hgdn_string hgdn_string_get(const godot_string *str) {
+    hgdn_string wrapper;
+    memset(&wrapper.gd_char_string, 0, sizeof(godot_char_string));
+    hgdn_string_view view = hgdn_string_view_get(str);
+    size_t length = hgdn__utf8_length_wide(view.ptr, view.length);
+    char *buffer = (char *) hgdn_alloc_tagged(length + 1, HGDN_MEMORY_TAG_STRING);
+    if (buffer == NULL) {
+        wrapper.ptr = hgdn__empty_cstring;
+        wrapper.length = 0;
+        return wrapper;
+    }
+    char *end = hgdn__utf8_encode_wide(buffer, view.ptr, view.length);
+    *end = '\0';
+    wrapper.ptr = buffer;
+    wrapper.length = (godot_int) (end - buffer);
+    return wrapper;
+}
+#else
 hgdn_string hgdn_string_get(const godot_string *str) {
     godot_char_string char_string = hgdn_core_api->godot_string_utf8(str);
     hgdn_string wrapper = {
@@ -1428,6 +4209,7 @@ hgdn_string hgdn_string_get(const godot_string *str) {
     };
     return wrapper;
 }
+#endif
 
 hgdn_string hgdn_string_get_own(godot_string str) {
     hgdn_string wrapper = hgdn_string_get(&str);
@@ -1436,7 +4218,51 @@ hgdn_string hgdn_string_get_own(godot_string str) {
 }
 
 void hgdn_string_destroy(hgdn_string *str) {
+#ifdef HGDN_USE_UTF8_TRANSCODER
+    if (str->ptr != hgdn__empty_cstring) {
+        hgdn_free((void *) str->ptr);
+    }
+    str->ptr = NULL;
+#else
     hgdn_core_api->godot_char_string_destroy(&str->gd_char_string);
+#endif
+}
+
+hgdn_string_view hgdn_string_view_get(const godot_string *str) {
+    hgdn_string_view view = {
+        hgdn_core_api->godot_string_wide_str(str),
+        hgdn_core_api->godot_string_length(str),
+    };
+    return view;
+}
+
+hgdn_utf8_string hgdn_string_view_utf8(hgdn_string_view view, char *buffer, size_t buffer_size) {
+    hgdn_utf8_string utf8 = { buffer, 0, NULL };
+    // Skip measuring when even the worst case of 4 bytes per character fits
+    if ((size_t) view.length * 4 >= buffer_size) {
+        size_t length = hgdn__utf8_length_wide(view.ptr, view.length);
+        if (length >= buffer_size) {
+            if ((utf8.heap_ptr = (char *) hgdn_alloc_tagged(length + 1, HGDN_MEMORY_TAG_STRING)) == NULL) {
+                utf8.ptr = "";
+                return utf8;
+            }
+            buffer = utf8.heap_ptr;
+            utf8.ptr = buffer;
+        }
+    }
+    char *end = hgdn__utf8_encode_wide(buffer, view.ptr, view.length);
+    *end = '\0';
+    utf8.length = (godot_int) (end - buffer);
+    return utf8;
+}
+
+hgdn_utf8_string hgdn_string_get_utf8(const godot_string *str, char *buffer, size_t buffer_size) {
+    return hgdn_string_view_utf8(hgdn_string_view_get(str), buffer, buffer_size);
+}
+
+void hgdn_utf8_string_destroy(hgdn_utf8_string *str) {
+    hgdn_free(str->heap_ptr);
+    str->heap_ptr = NULL;
 }
 
 // Pool String helpers
@@ -1472,10 +4298,10 @@ hgdn_string_array hgdn_string_array_get(const godot_pool_string_array *array) {
     godot_int size = hgdn_core_api->godot_pool_string_array_size(array);
     godot_pool_string_array_read_access *access = hgdn_core_api->godot_pool_string_array_read(array);
     hgdn_string_array wrapper = {0};
-    if ((wrapper.strings = (hgdn_string *) hgdn_alloc(size * sizeof(hgdn_string))) == NULL) {
+    if ((wrapper.strings = (hgdn_string *) hgdn_alloc_tagged(size * sizeof(hgdn_string), HGDN_MEMORY_TAG_STRING)) == NULL) {
         return wrapper;
     }
-    if ((wrapper.ptr = (const char **) hgdn_alloc(size * sizeof(char *))) == NULL) {
+    if ((wrapper.ptr = (const char **) hgdn_alloc_tagged(size * sizeof(char *), HGDN_MEMORY_TAG_STRING)) == NULL) {
         hgdn_free(wrapper.strings);
         return wrapper;
     }
@@ -1504,6 +4330,90 @@ void hgdn_string_array_destroy(hgdn_string_array *array) {
     hgdn_free((void *) array->ptr);
 }
 
+// Allocates from `arena` if not NULL, otherwise with `hgdn_alloc`
+static hgdn_packed_string_array hgdn__packed_string_array_get(const godot_pool_string_array *array, hgdn_arena *arena) {
+    godot_int size = hgdn_core_api->godot_pool_string_array_size(array);
+    godot_pool_string_array_read_access *access = hgdn_core_api->godot_pool_string_array_read(array);
+    const godot_string *gd_strings = hgdn_core_api->godot_pool_string_array_read_access_ptr(access);
+    hgdn_packed_string_array wrapper = {0};
+    // First pass: measure, so that pointers, offsets, lengths and data share a single allocation
+    size_t data_size = 0;
+    for (godot_int i = 0; i < size; i++) {
+        const wchar_t *wstr = hgdn_core_api->godot_string_wide_str(&gd_strings[i]);
+        data_size += hgdn__utf8_length_wide(wstr, hgdn_core_api->godot_string_length(&gd_strings[i])) + 1;
+    }
+    size_t table_size = size * (sizeof(const char *) + 2 * sizeof(godot_int));
+    uint8_t *buffer = (uint8_t *) (arena ? hgdn_arena_alloc(arena, table_size + data_size) : hgdn_alloc_tagged(table_size + data_size, HGDN_MEMORY_TAG_STRING));
+    if (buffer == NULL) {
+        hgdn_core_api->godot_pool_string_array_read_access_destroy(access);
+        return wrapper;
+    }
+    const char **ptr = (const char **) buffer;
+    godot_int *offsets = (godot_int *) (buffer + size * sizeof(const char *));
+    godot_int *lengths = offsets + size;
+    char *data = (char *) (lengths + size);
+    char *out = data;
+    for (godot_int i = 0; i < size; i++) {
+        const wchar_t *wstr = hgdn_core_api->godot_string_wide_str(&gd_strings[i]);
+        char *end = hgdn__utf8_encode_wide(out, wstr, hgdn_core_api->godot_string_length(&gd_strings[i]));
+        *end = '\0';
+        ptr[i] = out;
+        offsets[i] = (godot_int) (out - data);
+        lengths[i] = (godot_int) (end - out);
+        out = end + 1;
+    }
+    hgdn_core_api->godot_pool_string_array_read_access_destroy(access);
+    wrapper.ptr = ptr;
+    wrapper.offsets = offsets;
+    wrapper.lengths = lengths;
+    wrapper.data = data;
+    wrapper.size = size;
+    return wrapper;
+}
+
+hgdn_packed_string_array hgdn_packed_string_array_get(const godot_pool_string_array *array) {
+    return hgdn__packed_string_array_get(array, NULL);
+}
+
+hgdn_packed_string_array hgdn_packed_string_array_get_arena(const godot_pool_string_array *array, hgdn_arena *arena) {
+    return hgdn__packed_string_array_get(array, arena);
+}
+
+hgdn_packed_string_array hgdn_packed_string_array_get_own(godot_pool_string_array array) {
+    hgdn_packed_string_array result = hgdn_packed_string_array_get(&array);
+    hgdn_core_api->godot_pool_string_array_destroy(&array);
+    return result;
+}
+
+void hgdn_packed_string_array_destroy(hgdn_packed_string_array *array) {
+    // `ptr` points to the start of the single allocation
+    hgdn_free((void *) array->ptr);
+}
+
+#define HGDN_DECLARE_POOL_ARRAY_WRITE_API(kind) \
+    hgdn_##kind##_array_write hgdn_##kind##_array_write_get(godot_pool_##kind##_array *array) { \
+        godot_pool_##kind##_array_write_access *access = hgdn_core_api->godot_pool_##kind##_array_write(array); \
+        hgdn_##kind##_array_write wrapper = { \
+            access, \
+            hgdn_core_api->godot_pool_##kind##_array_write_access_ptr(access), \
+            hgdn_core_api->godot_pool_##kind##_array_size(array), \
+        }; \
+        return wrapper; \
+    } \
+    void hgdn_##kind##_array_write_destroy(hgdn_##kind##_array_write *array) { \
+        hgdn_core_api->godot_pool_##kind##_array_write_access_destroy(array->gd_write_access); \
+    }
+
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(byte)  // hgdn_byte_array_write_get, hgdn_byte_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(int)  // hgdn_int_array_write_get, hgdn_int_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(real)  // hgdn_real_array_write_get, hgdn_real_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(vector2)  // hgdn_vector2_array_write_get, hgdn_vector2_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(vector3)  // hgdn_vector3_array_write_get, hgdn_vector3_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(color)  // hgdn_color_array_write_get, hgdn_color_array_write_destroy
+HGDN_DECLARE_POOL_ARRAY_WRITE_API(string)  // hgdn_string_array_write_get, hgdn_string_array_write_destroy
+
+#undef HGDN_DECLARE_POOL_ARRAY_WRITE_API
+
 // Get values from Variant, Array, Dictionary and method arguments helpers
 #define HGDN_DECLARE_VARIANT_GET(kind, ctype) \
     ctype hgdn_variant_get_##kind(const godot_variant *var) { \
@@ -1532,13 +4442,20 @@ void hgdn_string_array_destroy(hgdn_string_array *array) {
         ctype value = hgdn_dictionary_get_##kind(dict, &key_var); \
         hgdn_core_api->godot_variant_destroy(&key_var); \
         return value; \
+    } \
+    ctype hgdn_dictionary_key_get_##kind(const godot_dictionary *dict, hgdn_key key) { \
+        if (key == NULL) { \
+            godot_variant nil = hgdn_new_nil_variant(); \
+            return hgdn_variant_get_##kind(&nil); \
+        } \
+        return hgdn_dictionary_get_##kind(dict, &key->variant); \
     }
 
 HGDN_DECLARE_VARIANT_GET(bool, godot_bool)  // hgdn_variant_get_bool
 HGDN_DECLARE_VARIANT_GET_OWN(bool, godot_bool)  // hgdn_variant_get_bool_own
 HGDN_DECLARE_ARRAY_GET(bool, godot_bool)  // hgdn_array_get_bool
 HGDN_DECLARE_ARGS_GET(bool, godot_bool)  // hgdn_args_get_bool
-HGDN_DECLARE_DICTIONARY_GET(bool, godot_bool)  // hgdn_dictionary_get_bool, hgdn_dictionary_string_get_bool
+HGDN_DECLARE_DICTIONARY_GET(bool, godot_bool)  // hgdn_dictionary_get_bool, hgdn_dictionary_string_get_bool, hgdn_dictionary_key_get_bool
 
 #define HGDN_DECLARE_VARIANT_API(kind, ctype) \
     HGDN_DECLARE_VARIANT_GET(kind, ctype) \
@@ -1547,66 +4464,545 @@ HGDN_DECLARE_DICTIONARY_GET(bool, godot_bool)  // hgdn_dictionary_get_bool, hgdn
     HGDN_DECLARE_ARGS_GET(kind, ctype) \
     HGDN_DECLARE_DICTIONARY_GET(kind, ctype)
 
-HGDN_DECLARE_VARIANT_API(uint, uint64_t)  // hgdn_variant_get_uint, hgdn_variant_get_uint_own, hgdn_array_get_uint, hgdn_args_get_uint, hgdn_dictionary_get_uint, hgdn_dictionary_string_get_uint
-HGDN_DECLARE_VARIANT_API(int, int64_t)  // hgdn_variant_get_int, hgdn_variant_get_int_own, hgdn_array_get_int, hgdn_args_get_int, hgdn_dictionary_get_int, hgdn_dictionary_string_get_int
-HGDN_DECLARE_VARIANT_API(real, double)  // hgdn_variant_get_real, hgdn_variant_get_real_own, hgdn_array_get_real, hgdn_args_get_real, hgdn_dictionary_get_real, hgdn_dictionary_string_get_real
-HGDN_DECLARE_VARIANT_API(vector2, godot_vector2)  // hgdn_variant_get_vector2, hgdn_variant_get_vector2_own, hgdn_array_get_vector2, hgdn_args_get_vector2, hgdn_dictionary_get_vector2, hgdn_dictionary_string_get_vector2
-HGDN_DECLARE_VARIANT_API(vector3, godot_vector3)  // hgdn_variant_get_vector3, hgdn_variant_get_vector3_own, hgdn_array_get_vector3, hgdn_args_get_vector3, hgdn_dictionary_get_vector3, hgdn_dictionary_string_get_vector3
-HGDN_DECLARE_VARIANT_API(rect2, godot_rect2)  // hgdn_variant_get_rect2, hgdn_variant_get_rect2_own, hgdn_array_get_rect2, hgdn_args_get_rect2, hgdn_dictionary_get_rect2, hgdn_dictionary_string_get_rect2
-HGDN_DECLARE_VARIANT_API(plane, godot_plane)  // hgdn_variant_get_plane, hgdn_variant_get_plane_own, hgdn_array_get_plane, hgdn_args_get_plane, hgdn_dictionary_get_plane, hgdn_dictionary_string_get_plane
-HGDN_DECLARE_VARIANT_API(quat, godot_quat)  // hgdn_variant_get_quat, hgdn_variant_get_quat_own, hgdn_array_get_quat, hgdn_args_get_quat, hgdn_dictionary_get_quat, hgdn_dictionary_string_get_quat
-HGDN_DECLARE_VARIANT_API(aabb, godot_aabb)  // hgdn_variant_get_aabb, hgdn_variant_get_aabb_own, hgdn_array_get_aabb, hgdn_args_get_aabb, hgdn_dictionary_get_aabb, hgdn_dictionary_string_get_aabb
-HGDN_DECLARE_VARIANT_API(basis, godot_basis)  // hgdn_variant_get_basis, hgdn_variant_get_basis_own, hgdn_array_get_basis, hgdn_args_get_basis, hgdn_dictionary_get_basis, hgdn_dictionary_string_get_basis
-HGDN_DECLARE_VARIANT_API(transform2d, godot_transform2d)  // hgdn_variant_get_transform2d, hgdn_variant_get_transform2d_own, hgdn_array_get_transform2d, hgdn_args_get_transform2d, hgdn_dictionary_get_transform2d, hgdn_dictionary_string_get_transform2d
-HGDN_DECLARE_VARIANT_API(transform, godot_transform)  // hgdn_variant_get_transform, hgdn_variant_get_transform_own, hgdn_array_get_transform, hgdn_args_get_transform, hgdn_dictionary_get_transform, hgdn_dictionary_string_get_transform
-HGDN_DECLARE_VARIANT_API(color, godot_color)  // hgdn_variant_get_color, hgdn_variant_get_color_own, hgdn_array_get_color, hgdn_args_get_color, hgdn_dictionary_get_color, hgdn_dictionary_string_get_color
-HGDN_DECLARE_VARIANT_API(node_path, godot_node_path)  // hgdn_variant_get_node_path, hgdn_variant_get_node_path_own, hgdn_array_get_node_path, hgdn_args_get_node_path, hgdn_dictionary_get_node_path, hgdn_dictionary_string_get_node_path
-HGDN_DECLARE_VARIANT_API(rid, godot_rid)  // hgdn_variant_get_rid, hgdn_variant_get_rid_own, hgdn_array_get_rid, hgdn_args_get_rid, hgdn_dictionary_get_rid, hgdn_dictionary_string_get_rid
-HGDN_DECLARE_VARIANT_API(object, godot_object *)  // hgdn_variant_get_object, hgdn_variant_get_object_own, hgdn_array_get_object, hgdn_args_get_object, hgdn_dictionary_get_object, hgdn_dictionary_string_get_object
-HGDN_DECLARE_VARIANT_API(dictionary, godot_dictionary)  // hgdn_variant_get_dictionary, hgdn_variant_get_dictionary_own, hgdn_array_get_dictionary, hgdn_args_get_dictionary, hgdn_dictionary_get_dictionary, hgdn_dictionary_string_get_dictionary
-HGDN_DECLARE_VARIANT_API(array, godot_array)  // hgdn_variant_get_array, hgdn_variant_get_array_own, hgdn_array_get_array, hgdn_args_get_array, hgdn_dictionary_get_array, hgdn_dictionary_string_get_array
+HGDN_DECLARE_VARIANT_API(uint, uint64_t)  // hgdn_variant_get_uint, hgdn_variant_get_uint_own, hgdn_array_get_uint, hgdn_args_get_uint, hgdn_dictionary_get_uint, hgdn_dictionary_string_get_uint, hgdn_dictionary_key_get_uint
+HGDN_DECLARE_VARIANT_API(int, int64_t)  // hgdn_variant_get_int, hgdn_variant_get_int_own, hgdn_array_get_int, hgdn_args_get_int, hgdn_dictionary_get_int, hgdn_dictionary_string_get_int, hgdn_dictionary_key_get_int
+HGDN_DECLARE_VARIANT_API(real, double)  // hgdn_variant_get_real, hgdn_variant_get_real_own, hgdn_array_get_real, hgdn_args_get_real, hgdn_dictionary_get_real, hgdn_dictionary_string_get_real, hgdn_dictionary_key_get_real
+HGDN_DECLARE_VARIANT_API(vector2, godot_vector2)  // hgdn_variant_get_vector2, hgdn_variant_get_vector2_own, hgdn_array_get_vector2, hgdn_args_get_vector2, hgdn_dictionary_get_vector2, hgdn_dictionary_string_get_vector2, hgdn_dictionary_key_get_vector2
+HGDN_DECLARE_VARIANT_API(vector3, godot_vector3)  // hgdn_variant_get_vector3, hgdn_variant_get_vector3_own, hgdn_array_get_vector3, hgdn_args_get_vector3, hgdn_dictionary_get_vector3, hgdn_dictionary_string_get_vector3, hgdn_dictionary_key_get_vector3
+HGDN_DECLARE_VARIANT_API(rect2, godot_rect2)  // hgdn_variant_get_rect2, hgdn_variant_get_rect2_own, hgdn_array_get_rect2, hgdn_args_get_rect2, hgdn_dictionary_get_rect2, hgdn_dictionary_string_get_rect2, hgdn_dictionary_key_get_rect2
+HGDN_DECLARE_VARIANT_API(plane, godot_plane)  // hgdn_variant_get_plane, hgdn_variant_get_plane_own, hgdn_array_get_plane, hgdn_args_get_plane, hgdn_dictionary_get_plane, hgdn_dictionary_string_get_plane, hgdn_dictionary_key_get_plane
+HGDN_DECLARE_VARIANT_API(quat, godot_quat)  // hgdn_variant_get_quat, hgdn_variant_get_quat_own, hgdn_array_get_quat, hgdn_args_get_quat, hgdn_dictionary_get_quat, hgdn_dictionary_string_get_quat, hgdn_dictionary_key_get_quat
+HGDN_DECLARE_VARIANT_API(aabb, godot_aabb)  // hgdn_variant_get_aabb, hgdn_variant_get_aabb_own, hgdn_array_get_aabb, hgdn_args_get_aabb, hgdn_dictionary_get_aabb, hgdn_dictionary_string_get_aabb, hgdn_dictionary_key_get_aabb
+HGDN_DECLARE_VARIANT_API(basis, godot_basis)  // hgdn_variant_get_basis, hgdn_variant_get_basis_own, hgdn_array_get_basis, hgdn_args_get_basis, hgdn_dictionary_get_basis, hgdn_dictionary_string_get_basis, hgdn_dictionary_key_get_basis
+HGDN_DECLARE_VARIANT_API(transform2d, godot_transform2d)  // hgdn_variant_get_transform2d, hgdn_variant_get_transform2d_own, hgdn_array_get_transform2d, hgdn_args_get_transform2d, hgdn_dictionary_get_transform2d, hgdn_dictionary_string_get_transform2d, hgdn_dictionary_key_get_transform2d
+HGDN_DECLARE_VARIANT_API(transform, godot_transform)  // hgdn_variant_get_transform, hgdn_variant_get_transform_own, hgdn_array_get_transform, hgdn_args_get_transform, hgdn_dictionary_get_transform, hgdn_dictionary_string_get_transform, hgdn_dictionary_key_get_transform
+HGDN_DECLARE_VARIANT_API(color, godot_color)  // hgdn_variant_get_color, hgdn_variant_get_color_own, hgdn_array_get_color, hgdn_args_get_color, hgdn_dictionary_get_color, hgdn_dictionary_string_get_color, hgdn_dictionary_key_get_color
+HGDN_DECLARE_VARIANT_API(node_path, godot_node_path)  // hgdn_variant_get_node_path, hgdn_variant_get_node_path_own, hgdn_array_get_node_path, hgdn_args_get_node_path, hgdn_dictionary_get_node_path, hgdn_dictionary_string_get_node_path, hgdn_dictionary_key_get_node_path
+HGDN_DECLARE_VARIANT_API(rid, godot_rid)  // hgdn_variant_get_rid, hgdn_variant_get_rid_own, hgdn_array_get_rid, hgdn_args_get_rid, hgdn_dictionary_get_rid, hgdn_dictionary_string_get_rid, hgdn_dictionary_key_get_rid
+HGDN_DECLARE_VARIANT_API(object, godot_object *)  // hgdn_variant_get_object, hgdn_variant_get_object_own, hgdn_array_get_object, hgdn_args_get_object, hgdn_dictionary_get_object, hgdn_dictionary_string_get_object, hgdn_dictionary_key_get_object
+HGDN_DECLARE_VARIANT_API(dictionary, godot_dictionary)  // hgdn_variant_get_dictionary, hgdn_variant_get_dictionary_own, hgdn_array_get_dictionary, hgdn_args_get_dictionary, hgdn_dictionary_get_dictionary, hgdn_dictionary_string_get_dictionary, hgdn_dictionary_key_get_dictionary
+HGDN_DECLARE_VARIANT_API(array, godot_array)  // hgdn_variant_get_array, hgdn_variant_get_array_own, hgdn_array_get_array, hgdn_args_get_array, hgdn_dictionary_get_array, hgdn_dictionary_string_get_array, hgdn_dictionary_key_get_array
 
 #undef HGDN_DECLARE_VARIANT_GET
 
 hgdn_string hgdn_variant_get_string(const godot_variant *var) {
     return hgdn_string_get_own(hgdn_core_api->godot_variant_as_string(var));
 }
-HGDN_DECLARE_VARIANT_GET_OWN(string, hgdn_string)  // hgdn_variant_get_string_own
-HGDN_DECLARE_ARRAY_GET(string, hgdn_string)  // hgdn_array_get_string
-HGDN_DECLARE_ARGS_GET(string, hgdn_string)  // hgdn_args_get_string
-HGDN_DECLARE_DICTIONARY_GET(string, hgdn_string)  // hgdn_dictionary_get_string
+HGDN_DECLARE_VARIANT_GET_OWN(string, hgdn_string)  // hgdn_variant_get_string_own
+HGDN_DECLARE_ARRAY_GET(string, hgdn_string)  // hgdn_array_get_string
+HGDN_DECLARE_ARGS_GET(string, hgdn_string)  // hgdn_args_get_string
+HGDN_DECLARE_DICTIONARY_GET(string, hgdn_string)  // hgdn_dictionary_get_string, hgdn_dictionary_string_get_string, hgdn_dictionary_key_get_string
+
+// Strings held by Variants are shared by reference, so no characters are copied until the UTF-8 encoding
+hgdn_utf8_string hgdn_variant_get_string_utf8(const godot_variant *var, char *buffer, size_t buffer_size) {
+    godot_string str = hgdn_core_api->godot_variant_as_string(var);
+    hgdn_utf8_string utf8 = hgdn_string_get_utf8(&str, buffer, buffer_size);
+    hgdn_core_api->godot_string_destroy(&str);
+    return utf8;
+}
+
+hgdn_utf8_string hgdn_args_get_string_utf8(godot_variant **args, const godot_int index, char *buffer, size_t buffer_size) {
+    return hgdn_variant_get_string_utf8(args[index], buffer, buffer_size);
+}
+
+hgdn_utf8_string hgdn_array_get_string_utf8(const godot_array *array, const godot_int index, char *buffer, size_t buffer_size) {
+    return hgdn_variant_get_string_utf8(hgdn_core_api->godot_array_operator_index_const(array, index), buffer, buffer_size);
+}
+
+hgdn_utf8_string hgdn_dictionary_get_string_utf8(const godot_dictionary *dict, const godot_variant *key, char *buffer, size_t buffer_size) {
+    return hgdn_variant_get_string_utf8(hgdn_core_api->godot_dictionary_operator_index_const(dict, key), buffer, buffer_size);
+}
+
+hgdn_utf8_string hgdn_dictionary_string_get_string_utf8(const godot_dictionary *dict, const char *key, char *buffer, size_t buffer_size) {
+    godot_variant key_var = hgdn_new_cstring_variant(key);
+    hgdn_utf8_string value = hgdn_dictionary_get_string_utf8(dict, &key_var, buffer, buffer_size);
+    hgdn_core_api->godot_variant_destroy(&key_var);
+    return value;
+}
+
+hgdn_utf8_string hgdn_dictionary_key_get_string_utf8(const godot_dictionary *dict, hgdn_key key, char *buffer, size_t buffer_size) {
+    if (key == NULL) {
+        godot_variant nil = hgdn_new_nil_variant();
+        return hgdn_variant_get_string_utf8(&nil, buffer, buffer_size);
+    }
+    return hgdn_dictionary_get_string_utf8(dict, &key->variant, buffer, buffer_size);
+}
+
+// String hashing: Strings are encoded to UTF-8 in small chunks on the stack, so the hashes
+// match the ones from UTF-8 literals without allocating a CharString
+#define HGDN__UTF8_CHUNK_CHARS 16
+static godot_int hgdn__utf8_encode_chunk(char *out, const wchar_t *wstr, godot_int len, godot_int *out_consumed) {
+    godot_int count = len < HGDN__UTF8_CHUNK_CHARS ? len : HGDN__UTF8_CHUNK_CHARS;
+#if WCHAR_MAX <= 0xFFFF
+    // don't split surrogate pairs between chunks
+    if (count < len && (uint32_t) wstr[count - 1] >= 0xD800 && (uint32_t) wstr[count - 1] <= 0xDBFF) {
+        count--;
+    }
+#endif
+    *out_consumed = count;
+    return (godot_int) (hgdn__utf8_encode_wide(out, wstr, count) - out);
+}
+
+uint32_t hgdn_cstring_hash(const char *cstr) {
+    return hgdn__hash_cstring(HGDN_STRING_HASH_SEED, cstr);
+}
+
+uint32_t hgdn_string_view_hash(hgdn_string_view view) {
+    uint32_t hash = HGDN_STRING_HASH_SEED;
+    char chunk[HGDN__UTF8_CHUNK_CHARS * 4];
+    godot_int consumed;
+    for (godot_int i = 0; i < view.length; i += consumed) {
+        godot_int size = hgdn__utf8_encode_chunk(chunk, view.ptr + i, view.length - i, &consumed);
+        for (godot_int j = 0; j < size; j++) {
+            hash = (hash ^ (uint8_t) chunk[j]) * HGDN_STRING_HASH_PRIME;
+        }
+    }
+    return hash;
+}
+
+uint32_t hgdn_string_get_hash(const godot_string *str) {
+    return hgdn_string_view_hash(hgdn_string_view_get(str));
+}
+
+uint32_t hgdn_variant_get_string_hash(const godot_variant *var) {
+    godot_string str = hgdn_core_api->godot_variant_as_string(var);
+    uint32_t hash = hgdn_string_get_hash(&str);
+    hgdn_core_api->godot_string_destroy(&str);
+    return hash;
+}
+
+uint32_t hgdn_args_get_string_hash(godot_variant **args, const godot_int index) {
+    return hgdn_variant_get_string_hash(args[index]);
+}
+
+godot_bool hgdn_string_view_equals(hgdn_string_view view, const char *cstr) {
+    char chunk[HGDN__UTF8_CHUNK_CHARS * 4];
+    godot_int consumed;
+    for (godot_int i = 0; i < view.length; i += consumed) {
+        godot_int size = hgdn__utf8_encode_chunk(chunk, view.ptr + i, view.length - i, &consumed);
+        // `strncmp` stops at the NULL terminator if `cstr` is shorter than the String
+        if (strncmp(chunk, cstr, size) != 0 || memchr(chunk, '\0', size) != NULL) {
+            return 0;
+        }
+        cstr += size;
+    }
+    return *cstr == '\0';
+}
+
+godot_bool hgdn_variant_string_equals(const godot_variant *var, const char *cstr) {
+    godot_string str = hgdn_core_api->godot_variant_as_string(var);
+    godot_bool equals = hgdn_string_view_equals(hgdn_string_view_get(&str), cstr);
+    hgdn_core_api->godot_string_destroy(&str);
+    return equals;
+}
+
+godot_bool hgdn_args_string_equals(godot_variant **args, const godot_int index, const char *cstr) {
+    return hgdn_variant_string_equals(args[index], cstr);
+}
+#undef HGDN__UTF8_CHUNK_CHARS
+
+hgdn_wide_string hgdn_variant_get_wide_string(const godot_variant *var) {
+    return hgdn_wide_string_get_own(hgdn_core_api->godot_variant_as_string(var));
+}
+HGDN_DECLARE_VARIANT_GET_OWN(wide_string, hgdn_wide_string)  // hgdn_variant_get_wide_string_own
+HGDN_DECLARE_ARRAY_GET(wide_string, hgdn_wide_string)  // hgdn_array_get_wide_string
+HGDN_DECLARE_ARGS_GET(wide_string, hgdn_wide_string)  // hgdn_args_get_wide_string
+HGDN_DECLARE_DICTIONARY_GET(wide_string, hgdn_wide_string)  // hgdn_dictionary_get_wide_string, hgdn_dictionary_string_get_wide_string, hgdn_dictionary_key_get_wide_string
+
+#define HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(kind, ctype) \
+    ctype hgdn_variant_get_##kind(const godot_variant *var) { \
+        return hgdn_##kind##_get_own(hgdn_core_api->godot_variant_as_pool_##kind(var)); \
+    } \
+    HGDN_DECLARE_VARIANT_GET_OWN(kind, ctype) \
+    HGDN_DECLARE_ARRAY_GET(kind, ctype) \
+    HGDN_DECLARE_ARGS_GET(kind, ctype) \
+    HGDN_DECLARE_DICTIONARY_GET(kind, ctype)
+
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(byte_array, hgdn_byte_array)  // hgdn_variant_get_byte_array, hgdn_variant_get_byte_array_own, hgdn_array_get_byte_array, hgdn_args_get_byte_array, hgdn_dictionary_get_byte_array, hgdn_dictionary_string_get_byte_array, hgdn_dictionary_key_get_byte_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(int_array, hgdn_int_array)  // hgdn_variant_get_int_array, hgdn_variant_get_int_array_own, hgdn_array_get_int_array, hgdn_args_get_int_array, hgdn_dictionary_get_int_array, hgdn_dictionary_string_get_int_array, hgdn_dictionary_key_get_int_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(real_array, hgdn_real_array)  // hgdn_variant_get_real_array, hgdn_variant_get_real_array_own, hgdn_array_get_real_array, hgdn_args_get_real_array, hgdn_dictionary_get_real_array, hgdn_dictionary_string_get_real_array, hgdn_dictionary_key_get_real_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(string_array, hgdn_string_array)  // hgdn_variant_get_string_array, hgdn_variant_get_string_array_own, hgdn_array_get_string_array, hgdn_args_get_string_array, hgdn_dictionary_get_string_array, hgdn_dictionary_string_get_string_array, hgdn_dictionary_key_get_string_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(vector2_array, hgdn_vector2_array)  // hgdn_variant_get_vector2_array, hgdn_variant_get_vector2_array_own, hgdn_array_get_vector2_array, hgdn_args_get_vector2_array, hgdn_dictionary_get_vector2_array, hgdn_dictionary_string_get_vector2_array, hgdn_dictionary_key_get_vector2_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(vector3_array, hgdn_vector3_array)  // hgdn_variant_get_vector3_array, hgdn_variant_get_vector3_array_own, hgdn_array_get_vector3_array, hgdn_args_get_vector3_array, hgdn_dictionary_get_vector3_array, hgdn_dictionary_string_get_vector3_array, hgdn_dictionary_key_get_vector3_array
+HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(color_array, hgdn_color_array)  // hgdn_variant_get_color_array, hgdn_variant_get_color_array_own, hgdn_array_get_color_array, hgdn_args_get_color_array, hgdn_dictionary_get_color_array, hgdn_dictionary_string_get_color_array, hgdn_dictionary_key_get_color_array
+
+#undef HGDN_DECLARE_VARIANT_GET_POOL_ARRAY
+
+#undef HGDN_DECLARE_DICTIONARY_GET
+#undef HGDN_DECLARE_ARGS_GET
+#undef HGDN_DECLARE_ARRAY_GET
+#undef HGDN_DECLARE_VARIANT_GET_OWN
+
+// Argument unpacking
+#define HGDN__UNPACK_ANY -1
+#define HGDN__UNPACK_INVALID -2
+
+static const char *const hgdn__variant_type_names[] = {
+    "null", "bool", "int", "float", "String", "Vector2", "Rect2", "Vector3", "Transform2D",
+    "Plane", "Quat", "AABB", "Basis", "Transform", "Color", "NodePath", "RID", "Object",
+    "Dictionary", "Array", "PoolByteArray", "PoolIntArray", "PoolRealArray", "PoolStringArray",
+    "PoolVector2Array", "PoolVector3Array", "PoolColorArray",
+};
+static HGDN__THREAD_LOCAL char hgdn__unpack_error_buffer[128];
+
+static const char *hgdn__variant_type_name(int type) {
+    return type >= 0 && type < (int) (sizeof(hgdn__variant_type_names) / sizeof(hgdn__variant_type_names[0]))
+        ? hgdn__variant_type_names[type]
+        : "unknown";
+}
+
+// Consumes one signature code, returning the Variant type it expects
+static int hgdn__unpack_code(const char **signature) {
+    const char *s = *signature;
+    int type;
+    switch (*s++) {
+        case 'b': type = GODOT_VARIANT_TYPE_BOOL; break;
+        case 'i': case 'u': type = GODOT_VARIANT_TYPE_INT; break;
+        case 'f': type = GODOT_VARIANT_TYPE_REAL; break;
+        case 'R': type = GODOT_VARIANT_TYPE_RECT2; break;
+        case 'P': type = GODOT_VARIANT_TYPE_PLANE; break;
+        case 'Q': type = GODOT_VARIANT_TYPE_QUAT; break;
+        case 'A': type = GODOT_VARIANT_TYPE_AABB; break;
+        case 'B': type = GODOT_VARIANT_TYPE_BASIS; break;
+        case 'c': type = GODOT_VARIANT_TYPE_COLOR; break;
+        case 'n': type = GODOT_VARIANT_TYPE_NODE_PATH; break;
+        case 'r': type = GODOT_VARIANT_TYPE_RID; break;
+        case 'o': type = GODOT_VARIANT_TYPE_OBJECT; break;
+        case 'd': type = GODOT_VARIANT_TYPE_DICTIONARY; break;
+        case 'a': type = GODOT_VARIANT_TYPE_ARRAY; break;
+        case 's': case 'w': type = GODOT_VARIANT_TYPE_STRING; break;
+        case '*': type = HGDN__UNPACK_ANY; break;
+        case 'T':
+            if (*s == '2') {
+                s++;
+                type = GODOT_VARIANT_TYPE_TRANSFORM2D;
+            }
+            else {
+                type = GODOT_VARIANT_TYPE_TRANSFORM;
+            }
+            break;
+        case 'v':
+            switch (*s++) {
+                case '2': type = GODOT_VARIANT_TYPE_VECTOR2; break;
+                case '3': type = GODOT_VARIANT_TYPE_VECTOR3; break;
+                default: return HGDN__UNPACK_INVALID;
+            }
+            break;
+        case 'p':
+            switch (*s++) {
+                case 'b': type = GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY; break;
+                case 'i': type = GODOT_VARIANT_TYPE_POOL_INT_ARRAY; break;
+                case 'f': type = GODOT_VARIANT_TYPE_POOL_REAL_ARRAY; break;
+                case 's': type = GODOT_VARIANT_TYPE_POOL_STRING_ARRAY; break;
+                case 'c': type = GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY; break;
+                case 'v':
+                    switch (*s++) {
+                        case '2': type = GODOT_VARIANT_TYPE_POOL_VECTOR2_ARRAY; break;
+                        case '3': type = GODOT_VARIANT_TYPE_POOL_VECTOR3_ARRAY; break;
+                        default: return HGDN__UNPACK_INVALID;
+                    }
+                    break;
+                default: return HGDN__UNPACK_INVALID;
+            }
+            break;
+        default: return HGDN__UNPACK_INVALID;
+    }
+    *signature = s;
+    return type;
+}
+
+static godot_bool hgdn__unpack_accepts(int expected, godot_variant_type type) {
+    if (expected == (int) type || expected == HGDN__UNPACK_ANY) {
+        return true;
+    }
+    switch (expected) {
+        case GODOT_VARIANT_TYPE_INT:
+        case GODOT_VARIANT_TYPE_REAL:
+            return type == GODOT_VARIANT_TYPE_INT || type == GODOT_VARIANT_TYPE_REAL;
+        case GODOT_VARIANT_TYPE_OBJECT:
+            return type == GODOT_VARIANT_TYPE_NIL;
+        default:
+            return false;
+    }
+}
+
+// Arguments whose Variant and type are remembered between passes, later ones are fetched again
+#define HGDN__UNPACK_CACHED_ARGS 16
+
+// Either `args` or `array` is used as argument source.
+// The first pass only checks argument count and types, the second one converts values,
+// so nothing needs to be destroyed on failure. Variants and types fetched by the first
+// pass are kept on the stack, so the engine is queried only once per argument.
+static const char *hgdn__unpack(godot_variant **args, const godot_array *array, const godot_int argc, const char *signature, va_list values) {
+    const godot_variant *cached_vars[HGDN__UNPACK_CACHED_ARGS];
+    godot_variant_type cached_types[HGDN__UNPACK_CACHED_ARGS];
+    const char *s = signature;
+    godot_int required = 0, i;
+    for (i = 0; *s; i++) {
+        int expected = hgdn__unpack_code(&s);
+        if (expected == HGDN__UNPACK_INVALID) {
+            snprintf(hgdn__unpack_error_buffer, sizeof(hgdn__unpack_error_buffer), "Error: invalid unpack signature \"%s\" at code %d", signature, i + 1);
+            return hgdn__unpack_error_buffer;
+        }
+        godot_bool optional = *s == '?';
+        if (optional) {
+            s++;
+        }
+        else {
+            required = i + 1;
+        }
+        if (i >= argc) {
+            continue;
+        }
+        const godot_variant *var = args ? args[i] : hgdn_core_api->godot_array_operator_index_const(array, i);
+        godot_variant_type type = hgdn_core_api->godot_variant_get_type(var);
+        if (i < HGDN__UNPACK_CACHED_ARGS) {
+            cached_vars[i] = var;
+            cached_types[i] = type;
+        }
+        if (!hgdn__unpack_accepts(expected, type) && !(optional && type == GODOT_VARIANT_TYPE_NIL)) {
+            snprintf(hgdn__unpack_error_buffer, sizeof(hgdn__unpack_error_buffer), "Error: argument %d should be %s, got %s", i + 1, hgdn__variant_type_name(expected), hgdn__variant_type_name(type));
+            return hgdn__unpack_error_buffer;
+        }
+    }
+    if (argc < required) {
+        snprintf(hgdn__unpack_error_buffer, sizeof(hgdn__unpack_error_buffer), "Error: expected at least %d arguments, got %d", required, argc);
+        return hgdn__unpack_error_buffer;
+    }
+
+    s = signature;
+    for (i = 0; *s; i++) {
+        char code = *s;
+        int expected = hgdn__unpack_code(&s);
+        godot_bool optional = *s == '?';
+        if (optional) {
+            s++;
+        }
+        void *out = va_arg(values, void *);
+        if (i >= argc) {
+            continue;
+        }
+        const godot_variant *var;
+        godot_variant_type type;
+        if (i < HGDN__UNPACK_CACHED_ARGS) {
+            var = cached_vars[i];
+            type = cached_types[i];
+        }
+        else {
+            var = args ? args[i] : hgdn_core_api->godot_array_operator_index_const(array, i);
+            type = hgdn_core_api->godot_variant_get_type(var);
+        }
+        if (optional && type == GODOT_VARIANT_TYPE_NIL) {
+            continue;
+        }
+        switch (expected) {
+            case GODOT_VARIANT_TYPE_BOOL: *(godot_bool *) out = hgdn_variant_get_bool(var); break;
+            case GODOT_VARIANT_TYPE_INT:
+            case GODOT_VARIANT_TYPE_REAL:
+                if (code == 'i') {
+                    *(int64_t *) out = hgdn_variant_get_int(var);
+                }
+                else if (code == 'u') {
+                    *(uint64_t *) out = hgdn_variant_get_uint(var);
+                }
+                else {
+                    *(double *) out = hgdn_variant_get_real(var);
+                }
+                break;
+            case GODOT_VARIANT_TYPE_STRING:
+                if (code == 's') {
+                    *(hgdn_string *) out = hgdn_variant_get_string(var);
+                }
+                else {
+                    *(hgdn_wide_string *) out = hgdn_variant_get_wide_string(var);
+                }
+                break;
+            case GODOT_VARIANT_TYPE_VECTOR2: *(godot_vector2 *) out = hgdn_variant_get_vector2(var); break;
+            case GODOT_VARIANT_TYPE_RECT2: *(godot_rect2 *) out = hgdn_variant_get_rect2(var); break;
+            case GODOT_VARIANT_TYPE_VECTOR3: *(godot_vector3 *) out = hgdn_variant_get_vector3(var); break;
+            case GODOT_VARIANT_TYPE_TRANSFORM2D: *(godot_transform2d *) out = hgdn_variant_get_transform2d(var); break;
+            case GODOT_VARIANT_TYPE_PLANE: *(godot_plane *) out = hgdn_variant_get_plane(var); break;
+            case GODOT_VARIANT_TYPE_QUAT: *(godot_quat *) out = hgdn_variant_get_quat(var); break;
+            case GODOT_VARIANT_TYPE_AABB: *(godot_aabb *) out = hgdn_variant_get_aabb(var); break;
+            case GODOT_VARIANT_TYPE_BASIS: *(godot_basis *) out = hgdn_variant_get_basis(var); break;
+            case GODOT_VARIANT_TYPE_TRANSFORM: *(godot_transform *) out = hgdn_variant_get_transform(var); break;
+            case GODOT_VARIANT_TYPE_COLOR: *(godot_color *) out = hgdn_variant_get_color(var); break;
+            case GODOT_VARIANT_TYPE_NODE_PATH: *(godot_node_path *) out = hgdn_variant_get_node_path(var); break;
+            case GODOT_VARIANT_TYPE_RID: *(godot_rid *) out = hgdn_variant_get_rid(var); break;
+            case GODOT_VARIANT_TYPE_OBJECT: *(godot_object **) out = hgdn_variant_get_object(var); break;
+            case GODOT_VARIANT_TYPE_DICTIONARY: *(godot_dictionary *) out = hgdn_variant_get_dictionary(var); break;
+            case GODOT_VARIANT_TYPE_ARRAY: *(godot_array *) out = hgdn_variant_get_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_BYTE_ARRAY: *(hgdn_byte_array *) out = hgdn_variant_get_byte_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_INT_ARRAY: *(hgdn_int_array *) out = hgdn_variant_get_int_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_REAL_ARRAY: *(hgdn_real_array *) out = hgdn_variant_get_real_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_STRING_ARRAY: *(hgdn_string_array *) out = hgdn_variant_get_string_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_VECTOR2_ARRAY: *(hgdn_vector2_array *) out = hgdn_variant_get_vector2_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_VECTOR3_ARRAY: *(hgdn_vector3_array *) out = hgdn_variant_get_vector3_array(var); break;
+            case GODOT_VARIANT_TYPE_POOL_COLOR_ARRAY: *(hgdn_color_array *) out = hgdn_variant_get_color_array(var); break;
+            default: *(const godot_variant **) out = var; break;
+        }
+    }
+    return NULL;
+}
+
+#undef HGDN__UNPACK_CACHED_ARGS
+
+const char *hgdn_args_unpack(godot_variant **args, const godot_int argc, const char *signature, ...) {
+    va_list values;
+    va_start(values, signature);
+    const char *error = hgdn__unpack(args, NULL, argc, signature, values);
+    va_end(values);
+    return error;
+}
+
+const char *hgdn_array_unpack(const godot_array *array, const char *signature, ...) {
+    va_list values;
+    va_start(values, signature);
+    const char *error = hgdn__unpack(NULL, array, hgdn_core_api->godot_array_size(array), signature, values);
+    va_end(values);
+    return error;
+}
+
+const char *hgdn_args_check(godot_variant **args, const godot_int argc, const godot_variant_type *types, const godot_int count) {
+    if (argc < count) {
+        snprintf(hgdn__unpack_error_buffer, sizeof(hgdn__unpack_error_buffer), "Error: expected at least %d arguments, got %d", count, argc);
+        return hgdn__unpack_error_buffer;
+    }
+    for (godot_int i = 0; i < count; i++) {
+        if (types[i] == GODOT_VARIANT_TYPE_NIL) {
+            continue;
+        }
+        godot_variant_type type = hgdn_core_api->godot_variant_get_type(args[i]);
+        if (!hgdn__unpack_accepts(types[i], type)) {
+            snprintf(hgdn__unpack_error_buffer, sizeof(hgdn__unpack_error_buffer), "Error: argument %d should be %s, got %s", i + 1, hgdn__variant_type_name(types[i]), hgdn__variant_type_name(type));
+            return hgdn__unpack_error_buffer;
+        }
+    }
+    return NULL;
+}
+
+#undef HGDN__UNPACK_INVALID
+#undef HGDN__UNPACK_ANY
+
+// Interned strings
+static hgdn_interned_string *hgdn__intern_find(const hgdn__intern_table *table, uint32_t hash, const char *cstr) {
+    uint32_t mask = table->capacity - 1;
+    hgdn_interned_string *value;
+    for (uint32_t i = hash & mask; (value = (hgdn_interned_string *) hgdn__atomic_load_ptr(&table->entries[i].value)); i = (i + 1) & mask) {
+        if (table->entries[i].hash == hash && strcmp(value->ptr, cstr) == 0) {
+            return value;
+        }
+    }
+    return NULL;
+}
+
+static void hgdn__intern_insert(hgdn__intern_table *table, hgdn__intern_entry entry) {
+    uint32_t mask = table->capacity - 1;
+    uint32_t i = entry.hash & mask;
+    while (table->entries[i].value) {
+        i = (i + 1) & mask;
+    }
+    // Hash must be visible before the value publishes the entry
+    table->entries[i].hash = entry.hash;
+    hgdn__atomic_store_ptr(&table->entries[i].value, entry.value);
+}
 
-hgdn_wide_string hgdn_variant_get_wide_string(const godot_variant *var) {
-    return hgdn_wide_string_get_own(hgdn_core_api->godot_variant_as_string(var));
+static hgdn__intern_table *hgdn__intern_grow(hgdn__intern_table *table) {
+    uint32_t new_capacity = table ? table->capacity * 2 : 64;
+    hgdn__intern_table *new_table = (hgdn__intern_table *) hgdn_alloc_tagged(sizeof(hgdn__intern_table) + new_capacity * sizeof(hgdn__intern_entry), HGDN_MEMORY_TAG_CACHE);
+    if (new_table == NULL) {
+        return NULL;
+    }
+    new_table->retired = table;
+    new_table->entries = (hgdn__intern_entry *) (new_table + 1);
+    new_table->capacity = new_capacity;
+    memset(new_table->entries, 0, new_capacity * sizeof(hgdn__intern_entry));
+    if (table) {
+        for (uint32_t i = 0; i < table->capacity; i++) {
+            if (table->entries[i].value) {
+                hgdn__intern_insert(new_table, table->entries[i]);
+            }
+        }
+    }
+    hgdn__atomic_store_ptr(&hgdn__intern_table_ptr, new_table);
+    return new_table;
 }
-HGDN_DECLARE_VARIANT_GET_OWN(wide_string, hgdn_wide_string)  // hgdn_variant_get_wide_string_own
-HGDN_DECLARE_ARRAY_GET(wide_string, hgdn_wide_string)  // hgdn_array_get_wide_string
-HGDN_DECLARE_ARGS_GET(wide_string, hgdn_wide_string)  // hgdn_args_get_wide_string
-HGDN_DECLARE_DICTIONARY_GET(wide_string, hgdn_wide_string)  // hgdn_dictionary_get_wide_string
 
-#define HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(kind, ctype) \
-    ctype hgdn_variant_get_##kind(const godot_variant *var) { \
-        return hgdn_##kind##_get_own(hgdn_core_api->godot_variant_as_pool_##kind(var)); \
-    } \
-    HGDN_DECLARE_VARIANT_GET_OWN(kind, ctype) \
-    HGDN_DECLARE_ARRAY_GET(kind, ctype) \
-    HGDN_DECLARE_ARGS_GET(kind, ctype) \
-    HGDN_DECLARE_DICTIONARY_GET(kind, ctype)
+static hgdn_interned_string *hgdn__intern_new(const char *cstr) {
+    size_t length = strlen(cstr);
+    hgdn_interned_string *interned = (hgdn_interned_string *) hgdn_alloc_tagged(sizeof(hgdn_interned_string) + length + 1, HGDN_MEMORY_TAG_CACHE);
+    if (interned) {
+        char *key = (char *) (interned + 1);
+        memcpy(key, cstr, length + 1);
+        interned->ptr = key;
+        interned->length = (godot_int) length;
+        interned->string = hgdn_new_string_with_len(key, length);
+        hgdn_core_api->godot_string_name_new(&interned->string_name, &interned->string);
+        hgdn_core_api->godot_variant_new_string(&interned->variant, &interned->string);
+    }
+    return interned;
+}
 
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(byte_array, hgdn_byte_array)  // hgdn_variant_get_byte_array, hgdn_variant_get_byte_array_own, hgdn_array_get_byte_array, hgdn_args_get_byte_array, hgdn_dictionary_get_byte_array, hgdn_dictionary_string_get_byte_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(int_array, hgdn_int_array)  // hgdn_variant_get_int_array, hgdn_variant_get_int_array_own, hgdn_array_get_int_array, hgdn_args_get_int_array, hgdn_dictionary_get_int_array, hgdn_dictionary_string_get_int_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(real_array, hgdn_real_array)  // hgdn_variant_get_real_array, hgdn_variant_get_real_array_own, hgdn_array_get_real_array, hgdn_args_get_real_array, hgdn_dictionary_get_real_array, hgdn_dictionary_string_get_real_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(string_array, hgdn_string_array)  // hgdn_variant_get_string_array, hgdn_variant_get_string_array_own, hgdn_array_get_string_array, hgdn_args_get_string_array, hgdn_dictionary_get_string_array, hgdn_dictionary_string_get_string_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(vector2_array, hgdn_vector2_array)  // hgdn_variant_get_vector2_array, hgdn_variant_get_vector2_array_own, hgdn_array_get_vector2_array, hgdn_args_get_vector2_array, hgdn_dictionary_get_vector2_array, hgdn_dictionary_string_get_vector2_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(vector3_array, hgdn_vector3_array)  // hgdn_variant_get_vector3_array, hgdn_variant_get_vector3_array_own, hgdn_array_get_vector3_array, hgdn_args_get_vector3_array, hgdn_dictionary_get_vector3_array, hgdn_dictionary_string_get_vector3_array
-HGDN_DECLARE_VARIANT_GET_POOL_ARRAY(color_array, hgdn_color_array)  // hgdn_variant_get_color_array, hgdn_variant_get_color_array_own, hgdn_array_get_color_array, hgdn_args_get_color_array, hgdn_dictionary_get_color_array, hgdn_dictionary_string_get_color_array
+// Called on terminate, when no other thread may be interning strings anymore
+static void hgdn__intern_clear() {
+    hgdn__mutex_lock(&hgdn__intern_mutex);
+    hgdn__intern_table *table = hgdn__intern_table_ptr;
+    if (table) {
+        for (uint32_t i = 0; i < table->capacity; i++) {
+            hgdn_interned_string *interned = table->entries[i].value;
+            if (interned) {
+                hgdn_core_api->godot_variant_destroy(&interned->variant);
+                hgdn_core_api->godot_string_name_destroy(&interned->string_name);
+                hgdn_core_api->godot_string_destroy(&interned->string);
+                hgdn_free(interned);
+            }
+        }
+    }
+    while (table) {
+        hgdn__intern_table *retired = table->retired;
+        hgdn_free(table);
+        table = retired;
+    }
+    hgdn__intern_table_ptr = NULL;
+    hgdn__intern_table_size = 0;
+    memset(hgdn__intern_pointer_cache, 0, sizeof(hgdn__intern_pointer_cache));
+    hgdn__mutex_unlock(&hgdn__intern_mutex);
+}
 
-#undef HGDN_DECLARE_VARIANT_GET_POOL_ARRAY
+hgdn_key hgdn_intern_key(const char *cstr) {
+    return hgdn_intern_string(cstr);
+}
 
-#undef HGDN_DECLARE_DICTIONARY_GET
-#undef HGDN_DECLARE_ARGS_GET
-#undef HGDN_DECLARE_ARRAY_GET
-#undef HGDN_DECLARE_VARIANT_GET_OWN
+const hgdn_interned_string *hgdn_intern_string(const char *cstr) {
+    hgdn_interned_string **cached = &hgdn__intern_pointer_cache[((uintptr_t) cstr >> 3) % HGDN__INTERN_POINTER_CACHE_SIZE];
+    // Pointers may be reused for different contents (e.g.: stack buffers), so contents are always checked
+    hgdn_interned_string *interned = (hgdn_interned_string *) hgdn__atomic_load_ptr(cached);
+    if (interned && strcmp(interned->ptr, cstr) == 0) {
+        return interned;
+    }
+    uint32_t hash = hgdn_cstring_hash(cstr);
+    hgdn__intern_table *table = (hgdn__intern_table *) hgdn__atomic_load_ptr(&hgdn__intern_table_ptr);
+    interned = table ? hgdn__intern_find(table, hash, cstr) : NULL;
+    if (interned == NULL) {
+        hgdn__mutex_lock(&hgdn__intern_mutex);
+        // Another thread may have inserted it since the lock-free lookup
+        table = hgdn__intern_table_ptr;
+        interned = table ? hgdn__intern_find(table, hash, cstr) : NULL;
+        if (interned == NULL
+            && ((table && (hgdn__intern_table_size + 1) * 2 <= table->capacity) || (table = hgdn__intern_grow(table)))
+            && (interned = hgdn__intern_new(cstr)))
+        {
+            hgdn__intern_entry entry = { interned, hash };
+            hgdn__intern_insert(table, entry);
+            hgdn__intern_table_size++;
+        }
+        hgdn__mutex_unlock(&hgdn__intern_mutex);
+    }
+    if (interned) {
+        hgdn__atomic_store_ptr(cached, interned);
+    }
+    return interned;
+}
 
 // Object helpers
 godot_variant hgdn_object_callv(godot_object *instance, const char *method, const godot_array *args_array) {
@@ -1614,10 +5010,13 @@ godot_variant hgdn_object_callv(godot_object *instance, const char *method, cons
         args_array = &hgdn__empty_array;
     }
     godot_variant result;
-    godot_string method_str = hgdn_new_string(method);
-    const void *args[] = { &method_str, args_array };
+    hgdn_core_api->godot_variant_new_nil(&result);
+    const hgdn_interned_string *method_str = hgdn_intern_string(method);
+    if (method_str == NULL) {
+        return result;
+    }
+    const void *args[] = { &method_str->string, args_array };
     hgdn_core_api->godot_method_bind_ptrcall(hgdn_method_Object_callv, instance, args, &result);
-    hgdn_core_api->godot_string_destroy(&method_str);
     return result;
 }
 
@@ -1627,6 +5026,228 @@ godot_variant hgdn_object_callv_own(godot_object *instance, const char *method,
     return result;
 }
 
+// Calls Object's `call` method bind with `call_args[0]` reserved for the method name
+static godot_variant hgdn__object_call(godot_object *instance, const char *method, const godot_variant **call_args, const godot_int argc) {
+    const hgdn_interned_string *method_str = hgdn_intern_string(method);
+    if (method_str == NULL) {
+        return hgdn_new_nil_variant();
+    }
+    call_args[0] = &method_str->variant;
+    godot_variant_call_error error;
+    godot_variant result = hgdn_core_api->godot_method_bind_call(hgdn_method_Object_call, instance, call_args, argc + 1, &error);
+    if (error.error != GODOT_CALL_ERROR_CALL_OK) {
+        HGDN_PRINT_ERROR("Error calling method '%s': call error %d on argument %d", method, error.error, error.argument);
+    }
+    return result;
+}
+
+#define HGDN__OBJECT_CALL_ARGS_BEGIN(argc) \
+    const godot_variant *stack_args[HGDN_OBJECT_CALL_STACK_ARGS_MAX + 1]; \
+    const godot_variant **call_args = (argc) <= HGDN_OBJECT_CALL_STACK_ARGS_MAX \
+                                      ? stack_args \
+                                      : (const godot_variant **) hgdn_alloc(((argc) + 1) * sizeof(godot_variant *))
+#define HGDN__OBJECT_CALL_ARGS_END() \
+    if (call_args != stack_args) { \
+        hgdn_free((void *) call_args); \
+    }
+
+godot_variant hgdn_object_callp(godot_object *instance, const char *method, const godot_variant *const *args, const godot_int argc) {
+    HGDN__OBJECT_CALL_ARGS_BEGIN(argc);
+    if (call_args == NULL) {
+        return hgdn_new_nil_variant();
+    }
+    for (godot_int i = 0; i < argc; i++) {
+        call_args[i + 1] = args[i];
+    }
+    godot_variant result = hgdn__object_call(instance, method, call_args, argc);
+    HGDN__OBJECT_CALL_ARGS_END();
+    return result;
+}
+
+godot_variant hgdn_object_callp_own(godot_object *instance, const char *method, godot_variant *args, const godot_int argc) {
+    HGDN__OBJECT_CALL_ARGS_BEGIN(argc);
+    godot_variant result;
+    if (call_args) {
+        for (godot_int i = 0; i < argc; i++) {
+            call_args[i + 1] = &args[i];
+        }
+        result = hgdn__object_call(instance, method, call_args, argc);
+        HGDN__OBJECT_CALL_ARGS_END();
+    }
+    else {
+        // `args` are still owned by this call, so they're destroyed even if it couldn't be made
+        result = hgdn_new_nil_variant();
+    }
+    for (godot_int i = 0; i < argc; i++) {
+        hgdn_core_api->godot_variant_destroy(&args[i]);
+    }
+    return result;
+}
+
+#undef HGDN__OBJECT_CALL_ARGS_END
+#undef HGDN__OBJECT_CALL_ARGS_BEGIN
+
+godot_variant hgdn_object_get_named(godot_object *instance, const char *property) {
+    godot_variant result;
+    hgdn_core_api->godot_variant_new_nil(&result);
+    const hgdn_interned_string *property_str = hgdn_intern_string(property);
+    if (property_str) {
+        const void *args[] = { &property_str->string };
+        hgdn_core_api->godot_method_bind_ptrcall(hgdn_method_Object_get, instance, args, &result);
+    }
+    return result;
+}
+
+void hgdn_object_set_named_variant(godot_object *instance, const char *property, const godot_variant *value) {
+    const hgdn_interned_string *property_str = hgdn_intern_string(property);
+    if (property_str) {
+        const void *args[] = { &property_str->string, value };
+        hgdn_core_api->godot_method_bind_ptrcall(hgdn_method_Object_set, instance, args, NULL);
+    }
+}
+
+void hgdn_object_set_named_own(godot_object *instance, const char *property, godot_variant value) {
+    hgdn_object_set_named_variant(instance, property, &value);
+    hgdn_core_api->godot_variant_destroy(&value);
+}
+
+// Returns nil like Object's `set` does through `hgdn_object_call`, so `hgdn_object_set` has the same type for any property
+godot_variant hgdn__object_set_named_own(godot_object *instance, const char *property, godot_variant value) {
+    hgdn_object_set_named_own(instance, property, value);
+    return hgdn_new_nil_variant();
+}
+
+// Method bind helpers
+static hgdn__method_bind_entry *hgdn__method_bind_cache_find(uint32_t hash, const char *classname, const char *methodname) {
+    uint32_t mask = hgdn__method_bind_cache_capacity - 1;
+    for (uint32_t i = hash & mask; hgdn__method_bind_cache[i].key; i = (i + 1) & mask) {
+        hgdn__method_bind_entry *entry = &hgdn__method_bind_cache[i];
+        if (entry->hash == hash
+            && strcmp(entry->key, classname) == 0
+            && strcmp(entry->key + strlen(classname) + 1, methodname) == 0)
+        {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static godot_bool hgdn__method_bind_cache_grow() {
+    uint32_t new_capacity = hgdn__method_bind_cache_capacity ? hgdn__method_bind_cache_capacity * 2 : 64;
+    hgdn__method_bind_entry *new_cache = (hgdn__method_bind_entry *) hgdn_alloc_tagged(new_capacity * sizeof(hgdn__method_bind_entry), HGDN_MEMORY_TAG_CACHE);
+    if (new_cache == NULL) {
+        return 0;
+    }
+    memset(new_cache, 0, new_capacity * sizeof(hgdn__method_bind_entry));
+    for (uint32_t i = 0; i < hgdn__method_bind_cache_capacity; i++) {
+        hgdn__method_bind_entry *entry = &hgdn__method_bind_cache[i];
+        if (entry->key) {
+            uint32_t j = entry->hash & (new_capacity - 1);
+            while (new_cache[j].key) {
+                j = (j + 1) & (new_capacity - 1);
+            }
+            new_cache[j] = *entry;
+        }
+    }
+    hgdn_free(hgdn__method_bind_cache);
+    hgdn__method_bind_cache = new_cache;
+    hgdn__method_bind_cache_capacity = new_capacity;
+    return 1;
+}
+
+static void hgdn__method_bind_cache_clear() {
+    hgdn__mutex_lock(&hgdn__method_bind_cache_mutex);
+    for (uint32_t i = 0; i < hgdn__method_bind_cache_capacity; i++) {
+        hgdn_free(hgdn__method_bind_cache[i].key);
+    }
+    hgdn_free(hgdn__method_bind_cache);
+    hgdn__method_bind_cache = NULL;
+    hgdn__method_bind_cache_capacity = 0;
+    hgdn__method_bind_cache_size = 0;
+    hgdn__mutex_unlock(&hgdn__method_bind_cache_mutex);
+}
+
+godot_method_bind *hgdn_method_bind_get(const char *classname, const char *methodname) {
+    uint32_t hash = hgdn__hash_cstring(hgdn_cstring_hash(classname), methodname);
+    godot_method_bind *method_bind;
+    hgdn__mutex_lock(&hgdn__method_bind_cache_mutex);
+    hgdn__method_bind_entry *entry = hgdn__method_bind_cache ? hgdn__method_bind_cache_find(hash, classname, methodname) : NULL;
+    if (entry) {
+        method_bind = entry->method_bind;
+    }
+    else {
+        // NULL results are cached as well, so missing methods don't get looked up again
+        method_bind = hgdn_core_api->godot_method_bind_get_method(classname, methodname);
+        if ((hgdn__method_bind_cache_size + 1) * 2 <= hgdn__method_bind_cache_capacity || hgdn__method_bind_cache_grow()) {
+            size_t classname_size = strlen(classname) + 1, methodname_size = strlen(methodname) + 1;
+            char *key = (char *) hgdn_alloc_tagged(classname_size + methodname_size, HGDN_MEMORY_TAG_CACHE);
+            if (key) {
+                memcpy(key, classname, classname_size);
+                memcpy(key + classname_size, methodname, methodname_size);
+                uint32_t mask = hgdn__method_bind_cache_capacity - 1, i = hash & mask;
+                while (hgdn__method_bind_cache[i].key) {
+                    i = (i + 1) & mask;
+                }
+                hgdn__method_bind_entry new_entry = { key, method_bind, hash };
+                hgdn__method_bind_cache[i] = new_entry;
+                hgdn__method_bind_cache_size++;
+            }
+        }
+    }
+    hgdn__mutex_unlock(&hgdn__method_bind_cache_mutex);
+    return method_bind;
+}
+
+void hgdn_method_bind_ptrcall(godot_method_bind *method_bind, godot_object *instance, const void **args, void *ret) {
+    hgdn_core_api->godot_method_bind_ptrcall(method_bind, instance, args, ret);
+}
+
+#define HGDN_DECLARE_METHOD_BIND_PTRCALL(kind, ctype) \
+    ctype hgdn_method_bind_ptrcall_##kind(godot_method_bind *method_bind, godot_object *instance, const void **args) { \
+        ctype result; \
+        memset(&result, 0, sizeof(ctype)); \
+        hgdn_core_api->godot_method_bind_ptrcall(method_bind, instance, args, &result); \
+        return result; \
+    }
+// Non-POD return values are assigned to by Godot, so they must be constructed first
+#define HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(kind, ctype, constructor) \
+    ctype hgdn_method_bind_ptrcall_##kind(godot_method_bind *method_bind, godot_object *instance, const void **args) { \
+        ctype result; \
+        hgdn_core_api->constructor(&result); \
+        hgdn_core_api->godot_method_bind_ptrcall(method_bind, instance, args, &result); \
+        return result; \
+    }
+
+HGDN_DECLARE_METHOD_BIND_PTRCALL(bool, godot_bool)  // hgdn_method_bind_ptrcall_bool
+HGDN_DECLARE_METHOD_BIND_PTRCALL(int, int64_t)  // hgdn_method_bind_ptrcall_int
+HGDN_DECLARE_METHOD_BIND_PTRCALL(real, double)  // hgdn_method_bind_ptrcall_real
+HGDN_DECLARE_METHOD_BIND_PTRCALL(vector2, godot_vector2)  // hgdn_method_bind_ptrcall_vector2
+HGDN_DECLARE_METHOD_BIND_PTRCALL(vector3, godot_vector3)  // hgdn_method_bind_ptrcall_vector3
+HGDN_DECLARE_METHOD_BIND_PTRCALL(rect2, godot_rect2)  // hgdn_method_bind_ptrcall_rect2
+HGDN_DECLARE_METHOD_BIND_PTRCALL(plane, godot_plane)  // hgdn_method_bind_ptrcall_plane
+HGDN_DECLARE_METHOD_BIND_PTRCALL(quat, godot_quat)  // hgdn_method_bind_ptrcall_quat
+HGDN_DECLARE_METHOD_BIND_PTRCALL(aabb, godot_aabb)  // hgdn_method_bind_ptrcall_aabb
+HGDN_DECLARE_METHOD_BIND_PTRCALL(basis, godot_basis)  // hgdn_method_bind_ptrcall_basis
+HGDN_DECLARE_METHOD_BIND_PTRCALL(transform2d, godot_transform2d)  // hgdn_method_bind_ptrcall_transform2d
+HGDN_DECLARE_METHOD_BIND_PTRCALL(transform, godot_transform)  // hgdn_method_bind_ptrcall_transform
+HGDN_DECLARE_METHOD_BIND_PTRCALL(color, godot_color)  // hgdn_method_bind_ptrcall_color
+HGDN_DECLARE_METHOD_BIND_PTRCALL(rid, godot_rid)  // hgdn_method_bind_ptrcall_rid
+HGDN_DECLARE_METHOD_BIND_PTRCALL(object, godot_object *)  // hgdn_method_bind_ptrcall_object
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(string, godot_string, godot_string_new)  // hgdn_method_bind_ptrcall_string
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(variant, godot_variant, godot_variant_new_nil)  // hgdn_method_bind_ptrcall_variant
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(dictionary, godot_dictionary, godot_dictionary_new)  // hgdn_method_bind_ptrcall_dictionary
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(array, godot_array, godot_array_new)  // hgdn_method_bind_ptrcall_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_byte_array, godot_pool_byte_array, godot_pool_byte_array_new)  // hgdn_method_bind_ptrcall_pool_byte_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_int_array, godot_pool_int_array, godot_pool_int_array_new)  // hgdn_method_bind_ptrcall_pool_int_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_real_array, godot_pool_real_array, godot_pool_real_array_new)  // hgdn_method_bind_ptrcall_pool_real_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_string_array, godot_pool_string_array, godot_pool_string_array_new)  // hgdn_method_bind_ptrcall_pool_string_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_vector2_array, godot_pool_vector2_array, godot_pool_vector2_array_new)  // hgdn_method_bind_ptrcall_pool_vector2_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_vector3_array, godot_pool_vector3_array, godot_pool_vector3_array_new)  // hgdn_method_bind_ptrcall_pool_vector3_array
+HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED(pool_color_array, godot_pool_color_array, godot_pool_color_array_new)  // hgdn_method_bind_ptrcall_pool_color_array
+
+#undef HGDN_DECLARE_METHOD_BIND_PTRCALL_CONSTRUCTED
+#undef HGDN_DECLARE_METHOD_BIND_PTRCALL
+
 // Create variants
 godot_variant hgdn_new_variant_copy(const godot_variant *value) {
     godot_variant var;
@@ -1776,14 +5397,364 @@ HGDN_CONSTEXPR godot_variant hgdn_new_variant(godot_variant value) { return valu
 godot_variant hgdn__variant_return(godot_variant value) { return value; }
 #endif  // __cplusplus
 
+// NativeScript profiler: shims registered in place of the original functions.
+// Entries are indexed by the position of their shim in `hgdn__profile_entries`.
+#ifndef HGDN_NO_EXT_NATIVESCRIPT
+#ifdef HGDN_PROFILE
+typedef struct hgdn__profile_entry {
+    char *name;
+    godot_instance_method method;
+    godot_property_get_func getter;
+    godot_property_set_func setter;
+} hgdn__profile_entry;
+
+typedef struct hgdn__profile_counters {
+    int64_t calls;
+    int64_t total_ns;
+    int64_t min_ns;
+    int64_t max_ns;
+    int64_t histogram[HGDN_PROFILE_HISTOGRAM_BUCKETS];
+} hgdn__profile_counters;
+
+typedef struct hgdn__profile_event {
+    int64_t entry;
+    int64_t start_ns;
+    int64_t duration_ns;
+} hgdn__profile_event;
+
+// Counters and events written only by their owner thread, merged when read
+typedef struct hgdn__profile_thread {
+    struct hgdn__profile_thread *next;
+    int64_t id;
+    int64_t event_count;
+    hgdn__profile_counters counters[HGDN_PROFILE_MAX_ENTRIES];
+    hgdn__profile_event events[HGDN_PROFILE_TRACE_EVENTS];
+} hgdn__profile_thread;
+
+static hgdn__profile_entry hgdn__profile_entries[HGDN_PROFILE_MAX_ENTRIES];
+static int64_t hgdn__profile_entry_count;
+static hgdn__mutex hgdn__profile_mutex = HGDN__MUTEX_INITIALIZER;
+static hgdn__profile_thread *hgdn__profile_threads;
+static int64_t hgdn__profile_thread_count;
+static int64_t hgdn__profile_generation;
+static HGDN__THREAD_LOCAL hgdn__profile_thread *hgdn__profile_current_thread;
+static HGDN__THREAD_LOCAL int64_t hgdn__profile_thread_generation;
+
+static int64_t hgdn__profile_now_ns() {
+#if defined(_WIN32)
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (int64_t) (counter.QuadPart / frequency.QuadPart * 1000000000 + counter.QuadPart % frequency.QuadPart * 1000000000 / frequency.QuadPart);
+#elif defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && defined(TIME_UTC)
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (int64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+#else
+    // Strict C99 without POSIX: processor time is the best portable clock available
+    return (int64_t) ((double) clock() * 1000000000.0 / CLOCKS_PER_SEC);
+#endif
+}
+
+static hgdn__profile_thread *hgdn__profile_get_thread() {
+    int64_t generation = hgdn__atomic_load(&hgdn__profile_generation);
+    if (hgdn__profile_current_thread == NULL || hgdn__profile_thread_generation != generation) {
+        hgdn__profile_thread *thread = (hgdn__profile_thread *) hgdn_alloc(sizeof(hgdn__profile_thread));
+        if (thread == NULL) {
+            return NULL;
+        }
+        memset(thread, 0, sizeof(hgdn__profile_thread));
+        hgdn__mutex_lock(&hgdn__profile_mutex);
+        thread->id = ++hgdn__profile_thread_count;
+        thread->next = hgdn__profile_threads;
+        hgdn__profile_threads = thread;
+        hgdn__profile_thread_generation = hgdn__profile_generation;
+        hgdn__mutex_unlock(&hgdn__profile_mutex);
+        hgdn__profile_current_thread = thread;
+    }
+    return hgdn__profile_current_thread;
+}
+
+static void hgdn__profile_clear() {
+    hgdn__mutex_lock(&hgdn__profile_mutex);
+    hgdn__profile_thread *thread = hgdn__profile_threads;
+    while (thread) {
+        hgdn__profile_thread *next = thread->next;
+        hgdn_free(thread);
+        thread = next;
+    }
+    hgdn__profile_threads = NULL;
+    hgdn__profile_thread_count = 0;
+    int64_t count = hgdn__atomic_load(&hgdn__profile_entry_count);
+    for (int64_t i = 0; i < count; i++) {
+        hgdn_free(hgdn__profile_entries[i].name);
+    }
+    memset(hgdn__profile_entries, 0, sizeof(hgdn__profile_entries));
+    hgdn__atomic_store(&hgdn__profile_entry_count, 0);
+    hgdn__atomic_store(&hgdn__profile_generation, hgdn__profile_generation + 1);
+    hgdn__mutex_unlock(&hgdn__profile_mutex);
+}
+
+static void hgdn__profile_record(const hgdn__profile_entry *entry, int64_t start_ns) {
+    int64_t end_ns = hgdn__profile_now_ns();
+    hgdn__profile_thread *thread = hgdn__profile_get_thread();
+    if (thread == NULL) {
+        return;
+    }
+    int64_t index = entry - hgdn__profile_entries;
+    int64_t elapsed = end_ns - start_ns;
+    hgdn__profile_counters *counters = &thread->counters[index];
+    if (counters->calls == 0 || elapsed < counters->min_ns) {
+        hgdn__counter_store(&counters->min_ns, elapsed);
+    }
+    if (elapsed > counters->max_ns) {
+        hgdn__counter_store(&counters->max_ns, elapsed);
+    }
+    int bucket = 0;
+    for (int64_t limit = 1000; elapsed > limit && bucket < HGDN_PROFILE_HISTOGRAM_BUCKETS - 1; limit <<= 1) {
+        bucket++;
+    }
+    hgdn__counter_add(&counters->histogram[bucket], 1);
+    hgdn__counter_add(&counters->total_ns, elapsed);
+    hgdn__counter_add(&counters->calls, 1);
+
+    hgdn__profile_event *event = &thread->events[thread->event_count & (HGDN_PROFILE_TRACE_EVENTS - 1)];
+    hgdn__counter_store(&event->entry, index);
+    hgdn__counter_store(&event->start_ns, start_ns);
+    hgdn__counter_store(&event->duration_ns, elapsed);
+    hgdn__atomic_store(&thread->event_count, thread->event_count + 1);
+}
+
+static godot_variant hgdn__profile_method(godot_object *instance, void *method_data, void *data, int argc, godot_variant **args) {
+    const hgdn__profile_entry *entry = (const hgdn__profile_entry *) method_data;
+    int64_t start_ns = hgdn__profile_now_ns();
+    godot_variant result = entry->method.method(instance, entry->method.method_data, data, argc, args);
+    hgdn__profile_record(entry, start_ns);
+    return result;
+}
+
+static godot_variant hgdn__profile_getter(godot_object *instance, void *method_data, void *data) {
+    const hgdn__profile_entry *entry = (const hgdn__profile_entry *) method_data;
+    int64_t start_ns = hgdn__profile_now_ns();
+    godot_variant result = entry->getter.get_func(instance, entry->getter.method_data, data);
+    hgdn__profile_record(entry, start_ns);
+    return result;
+}
+
+static void hgdn__profile_setter(godot_object *instance, void *method_data, void *data, godot_variant *value) {
+    const hgdn__profile_entry *entry = (const hgdn__profile_entry *) method_data;
+    int64_t start_ns = hgdn__profile_now_ns();
+    entry->setter.set_func(instance, entry->setter.method_data, data, value);
+    hgdn__profile_record(entry, start_ns);
+}
+
+// Forwards to the original `free_func`, entries themselves live until terminate
+static void hgdn__profile_free(void *method_data) {
+    hgdn__profile_entry *entry = (hgdn__profile_entry *) method_data;
+    if (entry->method.free_func) {
+        entry->method.free_func(entry->method.method_data);
+    }
+    if (entry->getter.free_func) {
+        entry->getter.free_func(entry->getter.method_data);
+    }
+    if (entry->setter.free_func) {
+        entry->setter.free_func(entry->setter.method_data);
+    }
+}
+
+static hgdn__profile_entry *hgdn__profile_new_entry(const char *classname, const char *name, const char *suffix) {
+    hgdn__mutex_lock(&hgdn__profile_mutex);
+    hgdn__profile_entry *entry = NULL;
+    if (hgdn__profile_entry_count < HGDN_PROFILE_MAX_ENTRIES) {
+        entry = &hgdn__profile_entries[hgdn__profile_entry_count];
+        size_t size = strlen(classname) + strlen(name) + strlen(suffix) + 3;
+        if ((entry->name = (char *) hgdn_alloc(size)) != NULL) {
+            snprintf(entry->name, size, "%s::%s%s", classname, name, suffix);
+            hgdn__atomic_store(&hgdn__profile_entry_count, hgdn__profile_entry_count + 1);
+        }
+        else {
+            entry = NULL;
+        }
+    }
+    hgdn__mutex_unlock(&hgdn__profile_mutex);
+    if (entry == NULL) {
+        HGDN_PRINT_WARNING("Not profiling %s::%s%s, increase HGDN_PROFILE_MAX_ENTRIES", classname, name, suffix);
+    }
+    return entry;
+}
+
+static godot_instance_method hgdn__profile_wrap_method(const char *classname, const char *name, godot_instance_method method) {
+    hgdn__profile_entry *entry;
+    if (method.method && (entry = hgdn__profile_new_entry(classname, name, ""))) {
+        entry->method = method;
+        godot_instance_method shim = { &hgdn__profile_method, entry, &hgdn__profile_free };
+        return shim;
+    }
+    return method;
+}
+
+static godot_property_get_func hgdn__profile_wrap_getter(const char *classname, const char *path, godot_property_get_func getter) {
+    hgdn__profile_entry *entry;
+    if (getter.get_func && (entry = hgdn__profile_new_entry(classname, path, " (get)"))) {
+        entry->getter = getter;
+        godot_property_get_func shim = { &hgdn__profile_getter, entry, &hgdn__profile_free };
+        return shim;
+    }
+    return getter;
+}
+
+static godot_property_set_func hgdn__profile_wrap_setter(const char *classname, const char *path, godot_property_set_func setter) {
+    hgdn__profile_entry *entry;
+    if (setter.set_func && (entry = hgdn__profile_new_entry(classname, path, " (set)"))) {
+        entry->setter = setter;
+        godot_property_set_func shim = { &hgdn__profile_setter, entry, &hgdn__profile_free };
+        return shim;
+    }
+    return setter;
+}
+#endif
+
+godot_int hgdn_profile_get_count() {
+#ifdef HGDN_PROFILE
+    return (godot_int) hgdn__atomic_load(&hgdn__profile_entry_count);
+#else
+    return 0;
+#endif
+}
+
+godot_int hgdn_profile_get_stats(hgdn_profile_stats *buffer, const godot_int size) {
+    godot_int count = hgdn_profile_get_count();
+    if (count > size) {
+        count = size;
+    }
+    if (count <= 0) {
+        return 0;
+    }
+    memset(buffer, 0, count * sizeof(hgdn_profile_stats));
+#ifdef HGDN_PROFILE
+    hgdn__mutex_lock(&hgdn__profile_mutex);
+    for (godot_int i = 0; i < count; i++) {
+        hgdn_profile_stats *stats = &buffer[i];
+        stats->name = hgdn__profile_entries[i].name;
+        for (hgdn__profile_thread *thread = hgdn__profile_threads; thread; thread = thread->next) {
+            const hgdn__profile_counters *counters = &thread->counters[i];
+            int64_t calls = hgdn__atomic_load(&counters->calls);
+            if (calls == 0) {
+                continue;
+            }
+            int64_t min_ns = hgdn__atomic_load(&counters->min_ns);
+            int64_t max_ns = hgdn__atomic_load(&counters->max_ns);
+            if (stats->calls == 0 || min_ns < stats->min_ns) {
+                stats->min_ns = min_ns;
+            }
+            if (max_ns > stats->max_ns) {
+                stats->max_ns = max_ns;
+            }
+            stats->calls += calls;
+            stats->total_ns += hgdn__atomic_load(&counters->total_ns);
+            for (int j = 0; j < HGDN_PROFILE_HISTOGRAM_BUCKETS; j++) {
+                stats->histogram[j] += hgdn__atomic_load(&counters->histogram[j]);
+            }
+        }
+    }
+    hgdn__mutex_unlock(&hgdn__profile_mutex);
+#endif
+    return count;
+}
+
+godot_dictionary hgdn_profile_to_dictionary() {
+    godot_dictionary dict;
+    hgdn_core_api->godot_dictionary_new(&dict);
+    godot_int count = hgdn_profile_get_count();
+    if (count <= 0) {
+        return dict;
+    }
+    hgdn_profile_stats *buffer = (hgdn_profile_stats *) hgdn_alloc(count * sizeof(hgdn_profile_stats));
+    if (buffer == NULL) {
+        return dict;
+    }
+    count = hgdn_profile_get_stats(buffer, count);
+    for (godot_int i = 0; i < count; i++) {
+        const hgdn_profile_stats *stats = &buffer[i];
+        godot_variant histogram[HGDN_PROFILE_HISTOGRAM_BUCKETS];
+        for (int j = 0; j < HGDN_PROFILE_HISTOGRAM_BUCKETS; j++) {
+            histogram[j] = hgdn_new_int_variant(stats->histogram[j]);
+        }
+        hgdn_dictionary_entry_string_own entries[] = {
+            { "calls", hgdn_new_int_variant(stats->calls) },
+            { "total_ns", hgdn_new_int_variant(stats->total_ns) },
+            { "min_ns", hgdn_new_int_variant(stats->min_ns) },
+            { "max_ns", hgdn_new_int_variant(stats->max_ns) },
+            { "histogram", hgdn_new_array_variant_own(hgdn_new_array_own(histogram, HGDN_PROFILE_HISTOGRAM_BUCKETS)) },
+        };
+        godot_variant key = hgdn_new_cstring_variant(stats->name);
+        godot_variant value = hgdn_new_dictionary_variant_own(hgdn_new_dictionary_string_own(entries, sizeof(entries) / sizeof(entries[0])));
+        hgdn_core_api->godot_dictionary_set(&dict, &key, &value);
+        hgdn_core_api->godot_variant_destroy(&key);
+        hgdn_core_api->godot_variant_destroy(&value);
+    }
+    hgdn_free(buffer);
+    return dict;
+}
+
+void hgdn_profile_append_trace_json(hgdn_string_builder *builder) {
+    hgdn_string_builder_append(builder, "{\"traceEvents\":[");
+#ifdef HGDN_PROFILE
+    godot_bool first = 1;
+    hgdn__mutex_lock(&hgdn__profile_mutex);
+    for (hgdn__profile_thread *thread = hgdn__profile_threads; thread; thread = thread->next) {
+        int64_t end = hgdn__atomic_load(&thread->event_count);
+        int64_t begin = end > HGDN_PROFILE_TRACE_EVENTS ? end - HGDN_PROFILE_TRACE_EVENTS : 0;
+        for (int64_t i = begin; i < end; i++) {
+            const hgdn__profile_event *event = &thread->events[i & (HGDN_PROFILE_TRACE_EVENTS - 1)];
+            int64_t entry = hgdn__atomic_load(&event->entry);
+            int64_t start_ns = hgdn__atomic_load(&event->start_ns) - hgdn__profile_base_ns;
+            int64_t duration_ns = hgdn__atomic_load(&event->duration_ns);
+            hgdn_string_builder_appendf(builder, "%s{\"name\":\"%s\",\"cat\":\"hgdn\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}",
+                                        first ? "" : ",", hgdn__profile_entries[entry].name,
+                                        start_ns / 1000.0, duration_ns / 1000.0, (int) thread->id);
+            first = 0;
+        }
+    }
+    hgdn__mutex_unlock(&hgdn__profile_mutex);
+#endif
+    hgdn_string_builder_append(builder, "],\"displayTimeUnit\":\"ns\"}");
+}
+
+godot_string hgdn_profile_trace_json() {
+    hgdn_string_builder builder = {0};
+    hgdn_profile_append_trace_json(&builder);
+    return hgdn_string_builder_to_string_own(&builder);
+}
+
+godot_variant hgdn_profile_native_call(godot_array *args) {
+    return hgdn_new_dictionary_variant_own(hgdn_profile_to_dictionary());
+}
+
+godot_variant hgdn_profile_method(godot_object *instance, void *method_data, void *data, int argc, godot_variant **args) {
+    return hgdn_new_dictionary_variant_own(hgdn_profile_to_dictionary());
+}
+#endif  // HGDN_NO_EXT_NATIVESCRIPT
+
 // NativeScript
 #ifndef HGDN_NO_EXT_NATIVESCRIPT
 void hgdn_register_class(void *handle, const hgdn_class_info *class_info) {
+    godot_instance_destroy_func destroy = class_info->destroy;
+    if (destroy.destroy_func == &hgdn_instance_pool_free && destroy.method_data == NULL) {
+        destroy.method_data = class_info->create.method_data;
+    }
     if (class_info->tool) {
-        hgdn_nativescript_api->godot_nativescript_register_tool_class(handle, class_info->name, class_info->base, class_info->create, class_info->destroy);
+        hgdn_nativescript_api->godot_nativescript_register_tool_class(handle, class_info->name, class_info->base, class_info->create, destroy);
     }
     else {
-        hgdn_nativescript_api->godot_nativescript_register_class(handle, class_info->name, class_info->base, class_info->create, class_info->destroy);
+        hgdn_nativescript_api->godot_nativescript_register_class(handle, class_info->name, class_info->base, class_info->create, destroy);
     }
 
     if (hgdn_nativescript_1_1_api && class_info->documentation) {
@@ -1802,7 +5773,14 @@ void hgdn_register_class(void *handle, const hgdn_class_info *class_info) {
                 property->usage,
                 property->default_value,
             };
-            hgdn_nativescript_api->godot_nativescript_register_property(handle, class_info->name, property->path, &attr, property->setter, property->getter);
+#ifdef HGDN_PROFILE
+            godot_property_set_func setter = hgdn__profile_wrap_setter(class_info->name, property->path, property->setter);
+            godot_property_get_func getter = hgdn__profile_wrap_getter(class_info->name, property->path, property->getter);
+#else
+            godot_property_set_func setter = property->setter;
+            godot_property_get_func getter = property->getter;
+#endif
+            hgdn_nativescript_api->godot_nativescript_register_property(handle, class_info->name, property->path, &attr, setter, getter);
             hgdn_core_api->godot_string_destroy(&attr.hint_string);
             if (hgdn_nativescript_1_1_api && property->documentation) {
                 godot_string documentation = hgdn_new_string(property->documentation);
@@ -1815,7 +5793,12 @@ void hgdn_register_class(void *handle, const hgdn_class_info *class_info) {
     if (class_info->methods) {
         for (hgdn_method_info *method = class_info->methods; method->name; method++) {
             godot_method_attributes attr = { method->rpc_type };
-            hgdn_nativescript_api->godot_nativescript_register_method(handle, class_info->name, method->name, attr, method->method);
+#ifdef HGDN_PROFILE
+            godot_instance_method instance_method = hgdn__profile_wrap_method(class_info->name, method->name, method->method);
+#else
+            godot_instance_method instance_method = method->method;
+#endif
+            hgdn_nativescript_api->godot_nativescript_register_method(handle, class_info->name, method->name, attr, instance_method);
             if (hgdn_nativescript_1_1_api) {
                 if (method->documentation) {
                     godot_string documentation = hgdn_new_string(method->documentation);
@@ -1883,7 +5866,7 @@ void hgdn_register_class(void *handle, const hgdn_class_info *class_info) {
 }
 
 void *hgdn_instance_alloc(godot_object *instance, void *alloc_size) {
-    void *buffer = hgdn_alloc((uintptr_t) alloc_size);
+    void *buffer = hgdn_alloc_tagged((uintptr_t) alloc_size, HGDN_MEMORY_TAG_INSTANCE);
     if (buffer) {
         memset(buffer, 0, (uintptr_t) alloc_size);
     }
@@ -1894,6 +5877,129 @@ void hgdn_instance_free(godot_object *instance, void *method_data, void *data) {
     hgdn_free(data);
 }
 
+// Instance pools: chunks are carved into slots that are recycled through an intrusive free list
+typedef struct hgdn__instance_pool_chunk {
+    struct hgdn__instance_pool_chunk *next;
+} hgdn__instance_pool_chunk;
+
+struct hgdn_instance_pool {
+    hgdn__mutex mutex;
+    void *free_list;
+    hgdn__instance_pool_chunk *chunks;
+    size_t instance_size;
+    size_t slot_size;
+    godot_int chunk_size;
+    hgdn_instance_pool_stats stats;
+};
+
+hgdn_instance_pool *hgdn_instance_pool_new(size_t instance_size, godot_int chunk_size) {
+    hgdn_instance_pool *pool = (hgdn_instance_pool *) hgdn_alloc_tagged(sizeof(hgdn_instance_pool), HGDN_MEMORY_TAG_INSTANCE);
+    if (pool == NULL) {
+        return NULL;
+    }
+    const hgdn__mutex mutex = HGDN__MUTEX_INITIALIZER;
+    pool->mutex = mutex;
+    pool->free_list = NULL;
+    pool->chunks = NULL;
+    pool->instance_size = instance_size;
+    // Free slots store the free list's next pointer
+    size_t slot_size = instance_size < sizeof(void *) ? sizeof(void *) : instance_size;
+    if (slot_size < HGDN_CACHE_LINE_SIZE) {
+        size_t power_of_two = sizeof(void *);
+        while (power_of_two < slot_size) {
+            power_of_two <<= 1;
+        }
+        slot_size = power_of_two;
+    }
+    else {
+        slot_size = (slot_size + HGDN_CACHE_LINE_SIZE - 1) & ~((size_t) HGDN_CACHE_LINE_SIZE - 1);
+    }
+    pool->slot_size = slot_size;
+    pool->chunk_size = chunk_size > 0 ? chunk_size : HGDN_INSTANCE_POOL_CHUNK_SIZE;
+    memset(&pool->stats, 0, sizeof(pool->stats));
+    return pool;
+}
+
+void hgdn_instance_pool_destroy(void *ptr) {
+    hgdn_instance_pool *pool = (hgdn_instance_pool *) ptr;
+    if (pool == NULL) {
+        return;
+    }
+    if (pool->stats.live > 0) {
+        HGDN_PRINT_WARNING("Destroying instance pool with %d live instances", (int) pool->stats.live);
+    }
+    hgdn__instance_pool_chunk *chunk = pool->chunks;
+    while (chunk) {
+        hgdn__instance_pool_chunk *next = chunk->next;
+        hgdn_free(chunk);
+        chunk = next;
+    }
+    hgdn_free(pool);
+}
+
+hgdn_instance_pool_stats hgdn_instance_pool_get_stats(hgdn_instance_pool *pool) {
+    hgdn__mutex_lock(&pool->mutex);
+    hgdn_instance_pool_stats stats = pool->stats;
+    hgdn__mutex_unlock(&pool->mutex);
+    return stats;
+}
+
+// Must be called with the pool locked
+static godot_bool hgdn__instance_pool_grow(hgdn_instance_pool *pool) {
+    hgdn__instance_pool_chunk *chunk = (hgdn__instance_pool_chunk *) hgdn_alloc_tagged(sizeof(hgdn__instance_pool_chunk) + HGDN_CACHE_LINE_SIZE - 1 + pool->slot_size * pool->chunk_size, HGDN_MEMORY_TAG_INSTANCE);
+    if (chunk == NULL) {
+        return false;
+    }
+    chunk->next = pool->chunks;
+    pool->chunks = chunk;
+    uintptr_t first_slot = ((uintptr_t) (chunk + 1) + HGDN_CACHE_LINE_SIZE - 1) & ~((uintptr_t) HGDN_CACHE_LINE_SIZE - 1);
+    // Link slots backwards, so they are handed out in address order
+    for (godot_int i = pool->chunk_size - 1; i >= 0; i--) {
+        void *slot = (void *) (first_slot + i * pool->slot_size);
+        *(void **) slot = pool->free_list;
+        pool->free_list = slot;
+    }
+    pool->stats.capacity += pool->chunk_size;
+    pool->stats.chunks++;
+    return true;
+}
+
+void *hgdn_instance_pool_alloc(godot_object *instance, void *ptr) {
+    hgdn_instance_pool *pool = (hgdn_instance_pool *) ptr;
+    if (pool == NULL) {
+        return NULL;
+    }
+    hgdn__mutex_lock(&pool->mutex);
+    void *slot = pool->free_list;
+    if (slot == NULL && hgdn__instance_pool_grow(pool)) {
+        slot = pool->free_list;
+    }
+    if (slot) {
+        pool->free_list = *(void **) slot;
+        pool->stats.live++;
+        if (pool->stats.live > pool->stats.peak) {
+            pool->stats.peak = pool->stats.live;
+        }
+    }
+    hgdn__mutex_unlock(&pool->mutex);
+    if (slot) {
+        memset(slot, 0, pool->instance_size);
+    }
+    return slot;
+}
+
+void hgdn_instance_pool_free(godot_object *instance, void *ptr, void *data) {
+    hgdn_instance_pool *pool = (hgdn_instance_pool *) ptr;
+    if (pool == NULL || data == NULL) {
+        return;
+    }
+    hgdn__mutex_lock(&pool->mutex);
+    *(void **) data = pool->free_list;
+    pool->free_list = data;
+    pool->stats.live--;
+    hgdn__mutex_unlock(&pool->mutex);
+}
+
 godot_variant *hgdn_property_constant_alloc(godot_variant value) {
     godot_variant *buffer = (godot_variant *) hgdn_alloc(sizeof(godot_variant));
     if (buffer) {
@@ -1905,13 +6011,133 @@ godot_variant *hgdn_property_constant_alloc(godot_variant value) {
 void hgdn_property_constant_free(void *value) {
     if (value) {
         hgdn_core_api->godot_variant_destroy((godot_variant *) value);
-        hgdn_core_api->godot_free(value);
+        hgdn_free(value);
     }
 }
 
 godot_variant hgdn_property_constant_get(godot_object *instance, void *value, void *data) {
     return hgdn_new_variant_copy((const godot_variant *) value);
 }
+
+#define HGDN__PROPERTY_FIELD_UNPACK(method_data)  { NULL, (uintptr_t) (method_data) >> 5, (hgdn_struct_field_type) ((uintptr_t) (method_data) & 31) }
+
+godot_variant hgdn_property_field_get(godot_object *instance, void *method_data, void *data) {
+    const hgdn_struct_field field = HGDN__PROPERTY_FIELD_UNPACK(method_data);
+    return hgdn__struct_field_to_variant(data, &field);
+}
+
+void hgdn_property_field_set(godot_object *instance, void *method_data, void *data, godot_variant *value) {
+    const hgdn_struct_field field = HGDN__PROPERTY_FIELD_UNPACK(method_data);
+    hgdn__struct_field_from_variant(data, &field, value);
+}
+
+#undef HGDN__PROPERTY_FIELD_UNPACK
+
+hgdn_property_field_info *hgdn_property_field_info_alloc(size_t offset, hgdn_struct_field_type type, double min, double max, void (*on_change)(godot_object *, void *, const hgdn_property_field_info *)) {
+    hgdn_property_field_info *info = (hgdn_property_field_info *) hgdn_alloc(sizeof(hgdn_property_field_info));
+    if (info) {
+        info->offset = offset;
+        info->type = type;
+        info->min = min;
+        info->max = max;
+        info->on_change = on_change;
+    }
+    return info;
+}
+
+// Value types have their size, String and Variant return 0
+static size_t hgdn__struct_field_size(hgdn_struct_field_type type) {
+    switch (type) {
+        case HGDN_FIELD_BOOL: return sizeof(godot_bool);
+        case HGDN_FIELD_INT: return sizeof(godot_int);
+        case HGDN_FIELD_INT64: return sizeof(int64_t);
+        case HGDN_FIELD_REAL: return sizeof(godot_real);
+        case HGDN_FIELD_DOUBLE: return sizeof(double);
+        case HGDN_FIELD_VECTOR2: return sizeof(godot_vector2);
+        case HGDN_FIELD_VECTOR3: return sizeof(godot_vector3);
+        case HGDN_FIELD_RECT2: return sizeof(godot_rect2);
+        case HGDN_FIELD_PLANE: return sizeof(godot_plane);
+        case HGDN_FIELD_QUAT: return sizeof(godot_quat);
+        case HGDN_FIELD_AABB: return sizeof(godot_aabb);
+        case HGDN_FIELD_BASIS: return sizeof(godot_basis);
+        case HGDN_FIELD_TRANSFORM2D: return sizeof(godot_transform2d);
+        case HGDN_FIELD_TRANSFORM: return sizeof(godot_transform);
+        case HGDN_FIELD_COLOR: return sizeof(godot_color);
+        case HGDN_FIELD_OBJECT: return sizeof(godot_object *);
+        case HGDN_FIELD_STRING:
+        case HGDN_FIELD_VARIANT: return 0;
+    }
+    return 0;
+}
+
+static double hgdn__clamp(double value, double min, double max) {
+    return value < min ? min : (value > max ? max : value);
+}
+
+// Compares as integers, so values beyond 2^53 don't lose precision in a double round trip.
+// Bounds outside the int64_t range don't clamp at all.
+static int64_t hgdn__clamp_int64(int64_t value, double min, double max) {
+    if (min >= -9223372036854775808.0 && value < (int64_t) min) {
+        return (int64_t) min;
+    }
+    if (max < 9223372036854775808.0 && value > (int64_t) max) {
+        return (int64_t) max;
+    }
+    return value;
+}
+
+void hgdn_property_field_set_ex(godot_object *instance, void *method_data, void *data, godot_variant *value) {
+    const hgdn_property_field_info *info = (const hgdn_property_field_info *) method_data;
+    if (info == NULL) {
+        // `hgdn_property_field_info_alloc` failed when the setter was created
+        return;
+    }
+    const hgdn_struct_field field = { NULL, info->offset, info->type };
+    uint8_t *ptr = (uint8_t *) data + info->offset;
+    // Big enough for any value type, String and Variant fields have size 0 and are not compared
+    uint8_t previous[sizeof(godot_transform)];
+    size_t size = hgdn__struct_field_size(info->type);
+    if (info->on_change && size > 0) {
+        memcpy(previous, ptr, size);
+    }
+    hgdn__struct_field_from_variant(data, &field, value);
+    if (info->min < info->max) {
+        switch (info->type) {
+            case HGDN_FIELD_INT: *(godot_int *) ptr = (godot_int) hgdn__clamp(*(godot_int *) ptr, info->min, info->max); break;
+            case HGDN_FIELD_INT64: *(int64_t *) ptr = hgdn__clamp_int64(*(int64_t *) ptr, info->min, info->max); break;
+            case HGDN_FIELD_REAL: *(godot_real *) ptr = (godot_real) hgdn__clamp(*(godot_real *) ptr, info->min, info->max); break;
+            case HGDN_FIELD_DOUBLE: *(double *) ptr = hgdn__clamp(*(double *) ptr, info->min, info->max); break;
+            default: break;
+        }
+    }
+    if (info->on_change && (size == 0 || memcmp(previous, ptr, size) != 0)) {
+        info->on_change(instance, data, info);
+    }
+}
+
+godot_int hgdn_struct_field_variant_type(hgdn_struct_field_type type) {
+    switch (type) {
+        case HGDN_FIELD_BOOL: return GODOT_VARIANT_TYPE_BOOL;
+        case HGDN_FIELD_INT:
+        case HGDN_FIELD_INT64: return GODOT_VARIANT_TYPE_INT;
+        case HGDN_FIELD_REAL:
+        case HGDN_FIELD_DOUBLE: return GODOT_VARIANT_TYPE_REAL;
+        case HGDN_FIELD_VECTOR2: return GODOT_VARIANT_TYPE_VECTOR2;
+        case HGDN_FIELD_VECTOR3: return GODOT_VARIANT_TYPE_VECTOR3;
+        case HGDN_FIELD_RECT2: return GODOT_VARIANT_TYPE_RECT2;
+        case HGDN_FIELD_PLANE: return GODOT_VARIANT_TYPE_PLANE;
+        case HGDN_FIELD_QUAT: return GODOT_VARIANT_TYPE_QUAT;
+        case HGDN_FIELD_AABB: return GODOT_VARIANT_TYPE_AABB;
+        case HGDN_FIELD_BASIS: return GODOT_VARIANT_TYPE_BASIS;
+        case HGDN_FIELD_TRANSFORM2D: return GODOT_VARIANT_TYPE_TRANSFORM2D;
+        case HGDN_FIELD_TRANSFORM: return GODOT_VARIANT_TYPE_TRANSFORM;
+        case HGDN_FIELD_COLOR: return GODOT_VARIANT_TYPE_COLOR;
+        case HGDN_FIELD_OBJECT: return GODOT_VARIANT_TYPE_OBJECT;
+        case HGDN_FIELD_STRING: return GODOT_VARIANT_TYPE_STRING;
+        case HGDN_FIELD_VARIANT: return GODOT_VARIANT_TYPE_NIL;
+    }
+    return GODOT_VARIANT_TYPE_NIL;
+}
 #endif  // HGDN_NO_EXT_NATIVESCRIPT
 
 #undef HGDN__FILL_FORMAT_BUFFER